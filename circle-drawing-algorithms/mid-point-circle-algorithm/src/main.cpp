@@ -1,13 +1,35 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <random>
+#include <thread>
+#include <unordered_map>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define CIRCLE_SIMD_X86 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CIRCLE_SIMD_NEON 1
+#endif
+
 const char* vertexShaderSource = R"glsl(
     #version 330 core
     layout (location = 0) in vec2 aPos;
+    uniform vec2 uScale;
+    uniform vec2 uOffset;
     void main() {
-        gl_Position = vec4(aPos, 0.0, 1.0);
+        gl_Position = vec4(aPos * uScale + uOffset, 0.0, 1.0);
     }
 )glsl";
 
@@ -19,34 +41,235 @@ const char* fragmentShaderSource = R"glsl(
     }
 )glsl";
 
-// Midpoint Circle Drawing Algorithm
-std::vector<float> generateCircleVertices(float centerX, float centerY, float radius) {
-    std::vector<float> vertices;
+// Horizontal run of pixels on row y, inclusive on both ends
+struct HorizontalSpan {
+    int y;
+    int xStart;
+    int xEnd;
+};
 
-    float scaledRadius = radius; // Ensure the radius fits within [-1, 1]
+// Pixel sinks. The rasterizers are templates over a Sink with
+// plot(int x, int y), so the destination is inlined into the pixel loop.
+
+// Writes vertex pairs around a normalized center, one pixel = 1/800
+struct CircleVertexSink {
+    float centerX;
+    float centerY;
+    float* out;
+
+    void plot(int x, int y) {
+        *out++ = centerX + static_cast<float>(x) / 800.0f; // Normalize to [-1, 1]
+        *out++ = centerY + static_cast<float>(y) / 800.0f;
+    }
+};
+
+// Writes pixel coordinates as int16 pairs, half the size of float pairs.
+// Coordinates must fit in int16; the vertex shader maps them to NDC.
+struct PackedVertexSink {
+    int16_t* out;
+
+    void plot(int x, int y) {
+        *out++ = static_cast<int16_t>(x);
+        *out++ = static_cast<int16_t>(y);
+    }
+};
+
+// Sets pixels in an 8-bit framebuffer, skipping any outside it
+struct FramebufferSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y) {
+        if (static_cast<unsigned>(x) < static_cast<unsigned>(width) && static_cast<unsigned>(y) < static_cast<unsigned>(height))
+            pixels[static_cast<size_t>(y) * width + x] = value;
+    }
+};
+
+// Collects horizontal spans, extending the last span while pixels continue it
+struct SpanSink {
+    std::vector<HorizontalSpan>& spans;
+
+    void plot(int x, int y) {
+        if (!spans.empty()) {
+            HorizontalSpan& last = spans.back();
+            if (last.y == y && last.xEnd + 1 == x) {
+                last.xEnd = x;
+                return;
+            }
+        }
+        spans.push_back({ y, x, x });
+    }
+};
+
+// Counts pixels without storing them
+struct CountingSink {
+    size_t count = 0;
+
+    void plot(int, int) {
+        ++count;
+    }
+};
+
+// Tracks the bounding box of all plotted pixels; empty while minX > maxX
+struct BoundingBoxSink {
+    int minX = INT_MAX;
+    int minY = INT_MAX;
+    int maxX = INT_MIN;
+    int maxY = INT_MIN;
+
+    void plot(int x, int y) {
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+};
+
+// Span sinks take span(int y, int xStart, int xEnd), inclusive on both ends;
+// the filled rasterizers emit one span per row into them.
+
+// Collects spans into a vector
+struct SpanListSink {
+    std::vector<HorizontalSpan>& spans;
+
+    void span(int y, int xStart, int xEnd) {
+        spans.push_back({ y, xStart, xEnd });
+    }
+};
+
+// Fills spans into an 8-bit framebuffer with memset, clipped to it
+struct FramebufferSpanSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void span(int y, int xStart, int xEnd) {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        xStart = std::max(xStart, 0);
+        xEnd = std::min(xEnd, width - 1);
+        if (xStart <= xEnd)
+            std::memset(pixels + static_cast<size_t>(y) * width + xStart, value, xEnd - xStart + 1);
+    }
+};
+
+// Coverage sinks take plot(int x, int y, int alpha) with an 8-bit coverage
+// alpha in 1..255; the anti-aliased rasterizers leave out empty pixels.
+
+// Pixel with 8-bit anti-aliasing coverage
+struct CoveragePixel {
+    int x;
+    int y;
+    uint8_t alpha;
+};
+
+// Collects coverage pixels into a vector
+struct CoverageListSink {
+    std::vector<CoveragePixel>& pixels;
+
+    void plot(int x, int y, int alpha) {
+        pixels.push_back({ x, y, static_cast<uint8_t>(alpha) });
+    }
+};
+
+// v / 255 rounded to nearest, for 0 <= v <= 255 * 255, without a division
+inline int div255(int v) {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+// Blends a gray level into an 8-bit grayscale buffer by coverage, skipping
+// pixels outside it
+struct GrayscaleBlendSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y, int alpha) {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t& dst = pixels[static_cast<size_t>(y) * width + x];
+        dst = static_cast<uint8_t>(div255(dst * (255 - alpha) + value * alpha));
+    }
+};
+
+// Blends a color into a buffer of 4-byte RGBA pixels by coverage, skipping
+// pixels outside it. The four channels are widened to 16-bit lanes of one
+// vector register and blended together.
+struct RgbaBlendSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t color[4];
+
+    void plot(int x, int y, int alpha) {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t* dst = pixels + 4 * (static_cast<size_t>(y) * width + x);
+#if CIRCLE_SIMD_X86
+        int32_t dstBits, colorBits;
+        std::memcpy(&dstBits, dst, 4);
+        std::memcpy(&colorBits, color, 4);
+        __m128i zero = _mm_setzero_si128();
+        __m128i d = _mm_unpacklo_epi8(_mm_cvtsi32_si128(dstBits), zero);
+        __m128i c = _mm_unpacklo_epi8(_mm_cvtsi32_si128(colorBits), zero);
+        __m128i v = _mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(static_cast<int16_t>(255 - alpha))),
+                                  _mm_mullo_epi16(c, _mm_set1_epi16(static_cast<int16_t>(alpha))));
+        v = _mm_add_epi16(v, _mm_set1_epi16(128));
+        v = _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+        int32_t out = _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+        std::memcpy(dst, &out, 4);
+#elif CIRCLE_SIMD_NEON
+        uint32_t dstBits, colorBits;
+        std::memcpy(&dstBits, dst, 4);
+        std::memcpy(&colorBits, color, 4);
+        uint8x8_t d = vreinterpret_u8_u32(vdup_n_u32(dstBits));
+        uint8x8_t c = vreinterpret_u8_u32(vdup_n_u32(colorBits));
+        uint16x8_t v = vmull_u8(d, vdup_n_u8(static_cast<uint8_t>(255 - alpha)));
+        v = vmlal_u8(v, c, vdup_n_u8(static_cast<uint8_t>(alpha)));
+        v = vaddq_u16(v, vdupq_n_u16(128));
+        uint32_t out = vget_lane_u32(vreinterpret_u32_u8(vshrn_n_u16(vsraq_n_u16(v, v, 8), 8)), 0);
+        std::memcpy(dst, &out, 4);
+#else
+        for (int i = 0; i < 4; ++i)
+            dst[i] = static_cast<uint8_t>(div255(dst[i] * (255 - alpha) + color[i] * alpha));
+#endif
+    }
+};
+
+// Upper bound on the points midpointCircle plots for a pixel radius. Each
+// step plots 8 points and the loop stops once x reaches y, near r / sqrt(2).
+// A negative radius counts as 0, which keeps the cast defined.
+size_t midpointCirclePointCount(int radius) {
+    return 8 * (static_cast<size_t>(std::max(radius, 0) / std::sqrt(2.0)) + 2);
+}
+
+// Upper bound on the vertices generateCircleVertices produces
+size_t circleVertexCount(float radius) {
+    return midpointCirclePointCount(static_cast<int>(radius * 800));
+}
+
+// Midpoint Circle Drawing Algorithm, plotting the 8 symmetric points of each
+// step around (centerX, centerY) into any pixel sink
+template <typename Sink>
+void midpointCircle(int centerX, int centerY, int radius, Sink& sink) {
     int x = 0;
-    int y = static_cast<int>(scaledRadius * 800); // Scale to screen resolution
+    int y = radius;
     int p = 1 - y;
 
     auto plotPoints = [&](int x, int y) {
-        float fx = static_cast<float>(x) / 800.0f; // Normalize to [-1, 1]
-        float fy = static_cast<float>(y) / 800.0f;
-        vertices.push_back(centerX + fx);
-        vertices.push_back(centerY + fy);
-        vertices.push_back(centerX - fx);
-        vertices.push_back(centerY + fy);
-        vertices.push_back(centerX + fx);
-        vertices.push_back(centerY - fy);
-        vertices.push_back(centerX - fx);
-        vertices.push_back(centerY - fy);
-        vertices.push_back(centerX + fy);
-        vertices.push_back(centerY + fx);
-        vertices.push_back(centerX - fy);
-        vertices.push_back(centerY + fx);
-        vertices.push_back(centerX + fy);
-        vertices.push_back(centerY - fx);
-        vertices.push_back(centerX - fy);
-        vertices.push_back(centerY - fx);
+        sink.plot(centerX + x, centerY + y);
+        sink.plot(centerX - x, centerY + y);
+        sink.plot(centerX + x, centerY - y);
+        sink.plot(centerX - x, centerY - y);
+        sink.plot(centerX + y, centerY + x);
+        sink.plot(centerX - y, centerY + x);
+        sink.plot(centerX + y, centerY - x);
+        sink.plot(centerX - y, centerY - x);
     };
 
     plotPoints(x, y);
@@ -61,11 +284,689 @@ std::vector<float> generateCircleVertices(float centerX, float centerY, float ra
         }
         plotPoints(x, y);
     }
+}
+
+// First-octant points of midpointCircle, from (0, r) towards the diagonal,
+// as separate x and y arrays. The final step can overshoot to x = y + 1,
+// which mirrors a point already in the octant; it is left out, so every
+// point kept has x <= y.
+void midpointCircleOctant(int radius, std::vector<int>& xs, std::vector<int>& ys) {
+    int x = 0;
+    int y = radius;
+    int p = 1 - y;
+
+    xs.clear();
+    ys.clear();
+    xs.reserve(midpointCirclePointCount(radius) / 8);
+    ys.reserve(midpointCirclePointCount(radius) / 8);
+    xs.push_back(x);
+    ys.push_back(y);
+
+    while (x < y) {
+        ++x;
+        if (p < 0) {
+            p += 2 * x + 1;
+        } else {
+            --y;
+            p += 2 * (x - y) + 1;
+        }
+        if (x > y)
+            break;
+        xs.push_back(x);
+        ys.push_back(y);
+    }
+}
+
+// Midpoint circle as one ordered, duplicate-free closed outline, running
+// counterclockwise from (centerX + radius, centerY). The first octant is
+// computed once, then each of the 8 octants is written as its own contiguous
+// run, alternate octants reversed so each run starts next to where the last
+// one ended. Runs leave out the axis and diagonal points the next run starts
+// with, so consecutive points are 8-connected and none repeats; the result
+// can be drawn as GL_LINE_LOOP or used as a polygon.
+template <typename Sink>
+void midpointCircleOutline(int centerX, int centerY, int radius, Sink& sink) {
+    if (radius <= 0) {
+        sink.plot(centerX, centerY);
+        return;
+    }
+
+    std::vector<int> xs;
+    std::vector<int> ys;
+    midpointCircleOctant(radius, xs, ys);
+    int m = static_cast<int>(xs.size());
+    int forwardEnd = xs[m - 1] == ys[m - 1] ? m - 1 : m;
+
+    for (int k = 0; k < forwardEnd; ++k)
+        sink.plot(centerX + ys[k], centerY + xs[k]);
+    for (int k = m - 1; k > 0; --k)
+        sink.plot(centerX + xs[k], centerY + ys[k]);
+    for (int k = 0; k < forwardEnd; ++k)
+        sink.plot(centerX - xs[k], centerY + ys[k]);
+    for (int k = m - 1; k > 0; --k)
+        sink.plot(centerX - ys[k], centerY + xs[k]);
+    for (int k = 0; k < forwardEnd; ++k)
+        sink.plot(centerX - ys[k], centerY - xs[k]);
+    for (int k = m - 1; k > 0; --k)
+        sink.plot(centerX - xs[k], centerY - ys[k]);
+    for (int k = 0; k < forwardEnd; ++k)
+        sink.plot(centerX + xs[k], centerY - ys[k]);
+    for (int k = m - 1; k > 0; --k)
+        sink.plot(centerX + ys[k], centerY - xs[k]);
+}
+
+// y of the first-octant midpointCircle pixel in column x (x <= y): the
+// largest y with y * (y - 1) < r^2 - x^2, which is where the midpoint loop
+// lands. Lets an arc start at any column without stepping up to it.
+inline int64_t midpointCircleSeekY(int64_t radius, int64_t x) {
+    int64_t g = radius * radius - x * x;
+    int64_t y = static_cast<int64_t>((1.0 + std::sqrt(1.0 + 4.0 * static_cast<double>(g))) / 2.0);
+    while (y > 0 && y * (y - 1) >= g)
+        --y;
+    while ((y + 1) * y < g)
+        ++y;
+    return y;
+}
+
+// Angle of first-octant pixel x from the +y axis, increasing with x
+inline double midpointCircleStepAngle(int64_t radius, int64_t x) {
+    return std::atan2(static_cast<double>(x), static_cast<double>(midpointCircleSeekY(radius, x)));
+}
+
+// Midpoint circle arc from startAngle counterclockwise to endAngle, in
+// radians from the +x axis. The pixels are those of midpointCircleOutline
+// whose angle lies in the arc, plotted in the same order and without
+// repeats. The outline is made of 8 octant runs that each cover 45 degrees;
+// the runs the arc touches and the first-octant column range within each are
+// worked out up front, the first pixel of a run is found in closed form, and
+// only those columns are stepped, so the cost is proportional to the arc.
+template <typename Sink>
+void midpointArc(int centerX, int centerY, int radius, double startAngle, double endAngle, Sink& sink) {
+    const double twoPi = 2.0 * 3.14159265358979323846;
+    const double octant = twoPi / 8.0;
+
+    // Pixels within rounding error of either end angle count as inside
+    const double tolerance = 1e-9;
+
+    double sweep = endAngle - startAngle;
+    if (sweep < 0.0)
+        return;
+    if (radius <= 0 || sweep >= twoPi - 2.0 * tolerance) {
+        midpointCircleOutline(centerX, centerY, radius, sink);
+        return;
+    }
+
+    int64_t r = radius;
+    double start = std::fmod(startAngle, twoPi) - tolerance;
+    if (start < 0.0)
+        start += twoPi;
+    double end = start + sweep + 2.0 * tolerance;
+
+    // Last first-octant column with x <= y, and whether it lies on the diagonal
+    int64_t lastX = static_cast<int64_t>(r / std::sqrt(2.0));
+    while (lastX > 0 && midpointCircleSeekY(r, lastX) < lastX)
+        --lastX;
+    while (midpointCircleSeekY(r, lastX + 1) >= lastX + 1)
+        ++lastX;
+    bool diagonal = midpointCircleSeekY(r, lastX) == lastX;
+
+    // Octant runs in outline order; pixel (x, y) of the first octant maps to
+    // (sx * x, sy * y), swapped first for runs 0, 3, 4 and 7
+    static const int runSign[8][2] = { { 1, 1 }, { 1, 1 }, { -1, 1 }, { -1, 1 }, { -1, -1 }, { -1, -1 }, { 1, -1 }, { 1, -1 } };
+    static const bool runSwap[8] = { true, false, false, true, true, false, false, true };
+
+    int firstRun = static_cast<int>(start / octant);
+    for (int visit = 0; visit <= 8; ++visit) {
+        int run = (firstRun + visit) % 8;
+        double runStart = (firstRun + visit) * octant;
+        double lo = std::max(runStart, start);
+        double hi = std::min(runStart + octant, end);
+        if (lo > hi)
+            continue;
+
+        // Even runs walk x up from the axis, odd runs walk it back down from
+        // the diagonal; each run leaves out the pixel the next one starts with
+        bool forward = run % 2 == 0;
+        double angleLo = forward ? lo - runStart : runStart + octant - hi;
+        double angleHi = forward ? hi - runStart : runStart + octant - lo;
+        int64_t ownedLo = forward ? 0 : 1;
+        int64_t ownedHi = forward && diagonal ? lastX - 1 : lastX;
+
+        // Column range whose pixel angle falls in [angleLo, angleHi]
+        int64_t xLo = std::min(ownedHi + 1, std::max(ownedLo, static_cast<int64_t>(r * std::sin(angleLo))));
+        while (xLo > ownedLo && midpointCircleStepAngle(r, xLo - 1) >= angleLo)
+            --xLo;
+        while (xLo <= ownedHi && midpointCircleStepAngle(r, xLo) < angleLo)
+            ++xLo;
+        int64_t xHi = std::max(ownedLo - 1, std::min(ownedHi, static_cast<int64_t>(r * std::sin(angleHi))));
+        while (xHi < ownedHi && midpointCircleStepAngle(r, xHi + 1) <= angleHi)
+            ++xHi;
+        while (xHi >= ownedLo && midpointCircleStepAngle(r, xHi) > angleHi)
+            --xHi;
+        if (xLo > xHi)
+            continue;
+
+        int sx = runSign[run][0];
+        int sy = runSign[run][1];
+        bool swap = runSwap[run];
+        auto plot = [&](int64_t x, int64_t y) {
+            int px = static_cast<int>(swap ? y : x);
+            int py = static_cast<int>(swap ? x : y);
+            sink.plot(centerX + sx * px, centerY + sy * py);
+        };
+
+        // Step the run with g = r^2 - x^2 kept incrementally; y moves by at
+        // most one per column inside the octant
+        int64_t x = forward ? xLo : xHi;
+        int64_t y = midpointCircleSeekY(r, x);
+        int64_t g = r * r - x * x;
+        plot(x, y);
+        if (forward) {
+            while (x < xHi) {
+                g -= 2 * x + 1;
+                ++x;
+                if (y * (y - 1) >= g)
+                    --y;
+                plot(x, y);
+            }
+        } else {
+            while (x > xLo) {
+                --x;
+                g += 2 * x + 1;
+                if ((y + 1) * y < g)
+                    ++y;
+                plot(x, y);
+            }
+        }
+    }
+}
+
+// Midpoint Circle Drawing Algorithm, writing into a caller-provided buffer.
+// capacity is in vertices (float pairs) and must be at least
+// circleVertexCount(radius); returns the number of vertices written, or 0
+// if the buffer is too small.
+size_t generateCircleVerticesInto(float centerX, float centerY, float radius, float* out, size_t capacity) {
+    if (capacity < circleVertexCount(radius))
+        return 0;
+
+    float scaledRadius = radius; // Ensure the radius fits within [-1, 1]
+    CircleVertexSink sink{ centerX, centerY, out };
+    midpointCircle(0, 0, static_cast<int>(scaledRadius * 800), sink); // Scale to screen resolution
+    return static_cast<size_t>(sink.out - out) / 2;
+}
+
+// Midpoint Circle Drawing Algorithm
+std::vector<float> generateCircleVertices(float centerX, float centerY, float radius) {
+    std::vector<float> vertices(2 * circleVertexCount(radius));
+    size_t count = generateCircleVerticesInto(centerX, centerY, radius, vertices.data(), vertices.size() / 2);
+    vertices.resize(2 * count);
+    return vertices;
+}
+
+// Midpoint Circle Drawing Algorithm, emitting packed int16 pixel coordinates
+std::vector<int16_t> generateCirclePackedVertices(int centerX, int centerY, int radius) {
+    std::vector<int16_t> vertices(2 * midpointCirclePointCount(radius));
+    PackedVertexSink sink{ vertices.data() };
+    midpointCircle(centerX, centerY, radius, sink);
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
+
+// Ordered circle outline as normalized vertices, ready for GL_LINE_LOOP
+std::vector<float> generateCircleOutlineVertices(float centerX, float centerY, float radius) {
+    std::vector<float> vertices(2 * circleVertexCount(radius));
+    CircleVertexSink sink{ centerX, centerY, vertices.data() };
+    midpointCircleOutline(0, 0, static_cast<int>(radius * 800), sink); // Scale to screen resolution
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
 
+// Ordered circle outline as packed int16 pixel coordinates
+std::vector<int16_t> generateCircleOutlinePackedVertices(int centerX, int centerY, int radius) {
+    std::vector<int16_t> vertices(2 * midpointCirclePointCount(radius));
+    PackedVertexSink sink{ vertices.data() };
+    midpointCircleOutline(centerX, centerY, radius, sink);
+    vertices.resize(sink.out - vertices.data());
     return vertices;
 }
 
-int main() {
+// Filled midpoint circle: one span per row, covering every pixel between the
+// left and right outline pixels of midpointCircle. The row half-widths come
+// from the first octant, each step giving the rows at distance y and x from
+// the center.
+template <typename Spans>
+void midpointCircleFilled(int centerX, int centerY, int radius, Spans& spans) {
+    if (radius < 0)
+        return;
+
+    std::vector<int> xs;
+    std::vector<int> ys;
+    midpointCircleOctant(radius, xs, ys);
+
+    std::vector<int> halfWidth(radius + 1, 0);
+    for (size_t k = 0; k < xs.size(); ++k) {
+        halfWidth[ys[k]] = std::max(halfWidth[ys[k]], xs[k]);
+        halfWidth[xs[k]] = std::max(halfWidth[xs[k]], ys[k]);
+    }
+
+    for (int dy = radius; dy >= 0; --dy) {
+        spans.span(centerY + dy, centerX - halfWidth[dy], centerX + halfWidth[dy]);
+        if (dy != 0)
+            spans.span(centerY - dy, centerX - halfWidth[dy], centerX + halfWidth[dy]);
+    }
+}
+
+// Filled midpoint circle as a list of spans
+std::vector<HorizontalSpan> generateFilledCircleSpans(int centerX, int centerY, int radius) {
+    std::vector<HorizontalSpan> spans;
+    spans.reserve(2 * static_cast<size_t>(std::max(radius, 0)) + 1);
+    SpanListSink sink{ spans };
+    midpointCircleFilled(centerX, centerY, radius, sink);
+    return spans;
+}
+
+// Filled midpoint circle drawn straight into an 8-bit framebuffer
+void fillCircle(int centerX, int centerY, int radius, uint8_t* pixels, int width, int height, uint8_t value) {
+    FramebufferSpanSink sink{ pixels, width, height, value };
+    midpointCircleFilled(centerX, centerY, radius, sink);
+}
+
+
+// Midpoint circle arc as normalized vertices, ready for GL_LINE_STRIP
+std::vector<float> generateArcVertices(float centerX, float centerY, float radius, float startAngle, float endAngle) {
+    std::vector<float> vertices(2 * circleVertexCount(radius));
+    CircleVertexSink sink{ centerX, centerY, vertices.data() };
+    midpointArc(0, 0, static_cast<int>(radius * 800), startAngle, endAngle, sink); // Scale to screen resolution
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
+
+// Midpoint circle arc as packed int16 pixel coordinates
+std::vector<int16_t> generateArcPackedVertices(int centerX, int centerY, int radius, float startAngle, float endAngle) {
+    std::vector<int16_t> vertices(2 * midpointCirclePointCount(radius));
+    PackedVertexSink sink{ vertices.data() };
+    midpointArc(centerX, centerY, radius, startAngle, endAngle, sink);
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
+
+// Rows and 8-bit coverages of the Wu columns x = first..first + count - 1 of
+// the curve y = sqrt(radiusSquared - x^2). Column x is covered by
+// the pixel pair (x, row) and (x, row + 1); the second gets alpha and the
+// first 255 - alpha.
+void wuCoverageScalar(float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    for (int i = 0; i < count; ++i) {
+        float x = static_cast<float>(first + i);
+        float y = std::sqrt(std::max(radiusSquared - x * x, 0.0f));
+        float row = std::floor(y);
+        rows[i] = static_cast<int>(row);
+        alphas[i] = static_cast<uint8_t>(static_cast<int>((y - row) * 255.0f + 0.5f));
+    }
+}
+
+#if CIRCLE_SIMD_X86
+// y is never negative, so truncation is the floor
+void wuCoverageSse(float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    const __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 vRadiusSquared = _mm_set1_ps(radiusSquared);
+    const __m128 zero = _mm_setzero_ps(), full = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_add_ps(_mm_set1_ps(static_cast<float>(first + i)), lane);
+        __m128 y = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(vRadiusSquared, _mm_mul_ps(x, x)), zero));
+        __m128i row = _mm_cvttps_epi32(y);
+        __m128i alpha = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(y, _mm_cvtepi32_ps(row)), full), half));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rows + i), row);
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(alpha, alpha), _mm_setzero_si128());
+        int four = _mm_cvtsi128_si32(packed);
+        std::memcpy(alphas + i, &four, 4);
+    }
+    wuCoverageScalar(radiusSquared, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+#if CIRCLE_SIMD_NEON && defined(__aarch64__)
+// vsqrtq needs AArch64
+void wuCoverageNeon(float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    const float laneInit[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t lane = vld1q_f32(laneInit);
+    const float32x4_t vRadiusSquared = vdupq_n_f32(radiusSquared);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vaddq_f32(vdupq_n_f32(static_cast<float>(first + i)), lane);
+        float32x4_t y = vsqrtq_f32(vmaxq_f32(vsubq_f32(vRadiusSquared, vmulq_f32(x, x)), vdupq_n_f32(0.0f)));
+        int32x4_t row = vcvtq_s32_f32(y);
+        int32x4_t alpha = vcvtq_s32_f32(vaddq_f32(vmulq_f32(vsubq_f32(y, vcvtq_f32_s32(row)), vdupq_n_f32(255.0f)), vdupq_n_f32(0.5f)));
+
+        vst1q_s32(rows + i, row);
+        uint8x8_t narrow = vqmovun_s16(vcombine_s16(vqmovn_s32(alpha), vdup_n_s16(0)));
+        vst1_lane_u32(reinterpret_cast<uint32_t*>(alphas + i), vreinterpret_u32_u8(narrow), 0);
+    }
+    wuCoverageScalar(radiusSquared, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+void wuCoverage(float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+#if CIRCLE_SIMD_X86
+    wuCoverageSse(radiusSquared, first, count, rows, alphas);
+#elif CIRCLE_SIMD_NEON && defined(__aarch64__)
+    wuCoverageNeon(radiusSquared, first, count, rows, alphas);
+#else
+    wuCoverageScalar(radiusSquared, first, count, rows, alphas);
+#endif
+}
+
+// Xiaolin Wu anti-aliased circle around (centerX, centerY) with a fractional
+// pixel radius of at least 1. Each first-octant column x is covered by the
+// two pixels straddling y = sqrt(r^2 - x^2), weighted by how close each is,
+// and mirrored to the 8 octants; the coverages are computed a block of
+// columns at a time. The x = 0 column and the diagonal pixel mirror onto
+// themselves and are plotted once, so blended outlines have no dark seams.
+// The octant owns the pixels on or above the diagonal; the column just past
+// the 45 degree point can still reach the diagonal, so it is walked too.
+template <typename Sink>
+void wuCircle(int centerX, int centerY, float radius, Sink& sink) {
+    if (!(radius >= 1.0f))
+        return;
+
+    // Last first-octant column: the largest x with 2 x^2 <= r^2
+    double radiusSquared = static_cast<double>(radius) * radius;
+    int last = static_cast<int>(radius / std::sqrt(2.0));
+    while (2.0 * last * last > radiusSquared)
+        --last;
+    while (2.0 * (last + 1) * (last + 1) <= radiusSquared)
+        ++last;
+
+    auto plot8 = [&](int x, int y, int alpha) {
+        if (alpha == 0)
+            return;
+        sink.plot(centerX + x, centerY + y, alpha);
+        sink.plot(centerX + x, centerY - y, alpha);
+        if (x != 0) {
+            sink.plot(centerX - x, centerY + y, alpha);
+            sink.plot(centerX - x, centerY - y, alpha);
+        }
+        if (x == y)
+            return;
+        sink.plot(centerX + y, centerY + x, alpha);
+        sink.plot(centerX - y, centerY + x, alpha);
+        if (x != 0) {
+            sink.plot(centerX + y, centerY - x, alpha);
+            sink.plot(centerX - y, centerY - x, alpha);
+        }
+    };
+
+    const int block = 64;
+    int rows[block];
+    uint8_t alphas[block];
+    for (int first = 0; first <= last + 1; first += block) {
+        int count = std::min(block, last + 2 - first);
+        wuCoverage(radius * radius, first, count, rows, alphas);
+        for (int i = 0; i < count; ++i) {
+            int x = first + i;
+            if (rows[i] >= x)
+                plot8(x, rows[i], 255 - alphas[i]);
+            if (rows[i] + 1 >= x)
+                plot8(x, rows[i] + 1, alphas[i]);
+        }
+    }
+}
+
+// Anti-aliased circle as coverage pixels
+std::vector<CoveragePixel> generateAntialiasedCirclePixels(int centerX, int centerY, float radius) {
+    std::vector<CoveragePixel> pixels;
+    pixels.reserve(16 * (static_cast<size_t>(radius / std::sqrt(2.0f)) + 2));
+    CoverageListSink sink{ pixels };
+    wuCircle(centerX, centerY, radius, sink);
+    return pixels;
+}
+
+// Anti-aliased circle blended into an 8-bit grayscale buffer
+void blendCircle(int centerX, int centerY, float radius, uint8_t* pixels, int width, int height, uint8_t value) {
+    GrayscaleBlendSink sink{ pixels, width, height, value };
+    wuCircle(centerX, centerY, radius, sink);
+}
+
+// Anti-aliased circle blended into an RGBA buffer of width * height pixels
+void blendCircleRgba(int centerX, int centerY, float radius, uint8_t* pixels, int width, int height, const uint8_t color[4]) {
+    RgbaBlendSink sink{ pixels, width, height, { color[0], color[1], color[2], color[3] } };
+    wuCircle(centerX, centerY, radius, sink);
+}
+
+// Bounded LRU cache of midpoint circle offset tables keyed by integer radius.
+// A table holds the packed offsets midpointCircle plots around (0, 0), so
+// any circle of that radius is the table translated by its center. Not
+// thread-safe; give each thread its own cache.
+struct CircleOffsetCache {
+    size_t capacity;
+    std::list<int> recent; // Radii, most recently used first
+    std::unordered_map<int, std::pair<std::vector<int16_t>, std::list<int>::iterator>> tables;
+
+    explicit CircleOffsetCache(size_t maxTables = 64) : capacity(std::max<size_t>(maxTables, 1)) {}
+
+    // Offset table for a radius of at most 32767, rasterized on a miss
+    const std::vector<int16_t>& offsets(int radius) {
+        auto it = tables.find(radius);
+        if (it != tables.end()) {
+            recent.splice(recent.begin(), recent, it->second.second);
+            return it->second.first;
+        }
+
+        if (tables.size() >= capacity) {
+            tables.erase(recent.back());
+            recent.pop_back();
+        }
+        recent.push_front(radius);
+        auto& entry = tables[radius];
+        entry.first = generateCirclePackedVertices(0, 0, radius);
+        entry.second = recent.begin();
+        return entry.first;
+    }
+};
+
+// Writes offsets + (centerX, centerY) for count packed pairs. The center is
+// repeated across a vector register so each add translates 4 points at once.
+void addCenterPacked(const int16_t* offsets, size_t count, int16_t centerX, int16_t centerY, int16_t* out) {
+    size_t n = 2 * count;
+    size_t i = 0;
+#if CIRCLE_SIMD_X86 || CIRCLE_SIMD_NEON
+    const int16_t centers[8] = { centerX, centerY, centerX, centerY, centerX, centerY, centerX, centerY };
+#if CIRCLE_SIMD_X86
+    __m128i center = _mm_loadu_si128(reinterpret_cast<const __m128i*>(centers));
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi16(v, center));
+    }
+#else
+    int16x8_t center = vld1q_s16(centers);
+    for (; i + 8 <= n; i += 8)
+        vst1q_s16(out + i, vaddq_s16(vld1q_s16(offsets + i), center));
+#endif
+#endif
+    for (; i < n; i += 2) {
+        out[i] = static_cast<int16_t>(offsets[i] + centerX);
+        out[i + 1] = static_cast<int16_t>(offsets[i + 1] + centerY);
+    }
+}
+
+// Cached form of generateCirclePackedVertices with identical output: the
+// offset table for the radius comes from the cache and is translated by the
+// center, so repeated radii cost a copy instead of a rasterization
+std::vector<int16_t> generateCirclePackedVerticesCached(int centerX, int centerY, int radius, CircleOffsetCache& cache) {
+    const std::vector<int16_t>& offsets = cache.offsets(radius);
+    std::vector<int16_t> vertices(offsets.size());
+    addCenterPacked(offsets.data(), offsets.size() / 2, static_cast<int16_t>(centerX), static_cast<int16_t>(centerY), vertices.data());
+    return vertices;
+}
+
+// Batch midpoint circles over separate center and radius arrays. Circle i
+// is rasterized exactly as generateCirclePackedVertices would and its packed
+// vertices start at offsets[i]; offsets gets count + 1 entries, the last
+// being the total. Coordinates must fit in int16.
+//
+// Circles are handed out in fixed-size chunks. Each thread starts on its own
+// contiguous run of chunks and, once that is used up, steals chunks from the
+// other threads' runs, so a few large radii do not leave the remaining
+// threads idle. Owner and thieves claim chunks from the same atomic counter.
+// Each thread writes into its own buffer; the buffers are merged in circle
+// order at the end, so the result does not depend on the schedule.
+void midpointCircleBatch(const int* centerX, const int* centerY, const int* radius, size_t count,
+                         std::vector<int16_t>& vertices, std::vector<size_t>& offsets, unsigned threadCount = 0) {
+    const size_t chunkSize = 64;
+    size_t chunks = (count + chunkSize - 1) / chunkSize;
+
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    unsigned workerCount = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(threadCount, chunks)));
+
+    // Run of chunks owned by each worker; next may run past end once it is drained
+    struct ChunkRange {
+        std::atomic<size_t> next;
+        size_t end;
+    };
+    std::vector<ChunkRange> ranges(workerCount);
+    for (unsigned w = 0; w < workerCount; ++w) {
+        ranges[w].next = chunks * w / workerCount;
+        ranges[w].end = chunks * (w + 1) / workerCount;
+    }
+
+    std::vector<std::vector<int16_t>> buffers(workerCount);
+    std::vector<size_t> pointCounts(count);
+    std::vector<unsigned> chunkWorker(chunks);
+    std::vector<size_t> chunkStart(chunks);
+
+    auto rasterizeChunk = [&](unsigned w, size_t c) {
+        std::vector<int16_t>& buffer = buffers[w];
+        chunkWorker[c] = w;
+        chunkStart[c] = buffer.size();
+        size_t last = std::min(count, (c + 1) * chunkSize);
+        for (size_t i = c * chunkSize; i < last; ++i) {
+            size_t base = buffer.size();
+            buffer.resize(base + 2 * midpointCirclePointCount(radius[i]));
+            PackedVertexSink sink{ buffer.data() + base };
+            midpointCircle(centerX[i], centerY[i], radius[i], sink);
+            buffer.resize(sink.out - buffer.data());
+            pointCounts[i] = (buffer.size() - base) / 2;
+        }
+    };
+
+    auto work = [&](unsigned w) {
+        for (unsigned k = 0; k < workerCount; ++k) {
+            ChunkRange& range = ranges[(w + k) % workerCount];
+            for (size_t c = range.next.fetch_add(1); c < range.end; c = range.next.fetch_add(1))
+                rasterizeChunk(w, c);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (unsigned w = 1; w < workerCount; ++w)
+        workers.emplace_back(work, w);
+    work(0);
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // Merge the per-thread buffers in circle order
+    offsets.resize(count + 1);
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; ++i)
+        offsets[i + 1] = offsets[i] + pointCounts[i];
+
+    vertices.resize(2 * offsets[count]);
+    for (size_t c = 0; c < chunks; ++c) {
+        size_t first = c * chunkSize;
+        size_t last = std::min(count, first + chunkSize);
+        const int16_t* chunkData = buffers[chunkWorker[c]].data() + chunkStart[c];
+        std::memcpy(vertices.data() + 2 * offsets[first], chunkData, 2 * (offsets[last] - offsets[first]) * sizeof(int16_t));
+    }
+}
+
+// Rasterizes a fixed random set of marker circles with 1 to 64 threads and
+// prints the throughput of each run. Most radii are small with a tail of
+// large ones, the mix that makes static partitioning imbalanced.
+void benchmarkCircleBatch(size_t count = 1000000) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> position(-16000, 16000);
+    std::uniform_int_distribution<int> smallRadius(1, 8);
+    std::uniform_int_distribution<int> largeRadius(9, 400);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    std::vector<int> centerX(count), centerY(count), radius(count);
+    for (size_t i = 0; i < count; ++i) {
+        centerX[i] = position(rng);
+        centerY[i] = position(rng);
+        radius[i] = percent(rng) < 95 ? smallRadius(rng) : largeRadius(rng);
+    }
+
+    std::vector<int16_t> vertices;
+    std::vector<size_t> offsets;
+    for (unsigned threads = 1; threads <= 64; threads *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        midpointCircleBatch(centerX.data(), centerY.data(), radius.data(), count, vertices, offsets, threads);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << threads << " threads: " << static_cast<double>(count) / elapsed.count() << " circles/s ("
+                  << vertices.size() / 2 << " points)" << std::endl;
+    }
+}
+
+// Checks that Wu coverage never drops along the outline: for a sweep of
+// fractional radii, every pixel whose centre lies within 0.2 of the circle
+// must be blended to at least 160. Such a pixel is at most 0.2 * sqrt(2)
+// from the curve along its column or row, so a correct outline gives it
+// about 180 or more. Prints the result and returns whether every radius
+// passed.
+bool verifyWuCoverage() {
+    std::vector<float> radii = { 38.181f };
+    for (int k = 0; k < 2000; ++k)
+        radii.push_back(1.0f + 0.173f * k);
+
+    size_t notches = 0;
+    for (float radius : radii) {
+        int half = static_cast<int>(std::ceil(radius)) + 2;
+        int size = 2 * half + 1;
+        std::vector<uint8_t> coverage(static_cast<size_t>(size) * size, 0);
+        blendCircle(half, half, radius, coverage.data(), size, size, 255);
+
+        bool ok = true;
+        auto check = [&](int x, int y) {
+            if (x < -half || x > half || y < -half || y > half)
+                return;
+            double distance = std::fabs(std::hypot(static_cast<double>(x), static_cast<double>(y)) - radius);
+            if (distance <= 0.2 && coverage[static_cast<size_t>(y + half) * size + x + half] < 160)
+                ok = false;
+        };
+        // Candidates near the curve, found from every row and every column
+        for (int u = -half; u <= half; ++u) {
+            int v = static_cast<int>(std::sqrt(std::max(static_cast<double>(radius) * radius - u * u, 0.0)));
+            for (int w = v - 1; w <= v + 2; ++w) {
+                check(u, w);
+                check(u, -w);
+                check(w, u);
+                check(-w, u);
+            }
+        }
+        if (!ok)
+            ++notches;
+    }
+    std::cout << "wu circle: " << radii.size() << " radii, " << notches << " with notches" << std::endl;
+    return notches == 0;
+}
+
+int main(int argc, char** argv) {
+    // Headless check that the anti-aliased outline has no gaps
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0)
+        return verifyWuCoverage() ? 0 : 1;
+
+    // Headless throughput run of the batch rasterizer
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        benchmarkCircleBatch();
+        return 0;
+    }
+
     // Initialize GLFW
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW" << std::endl;
@@ -114,7 +1015,26 @@ int main() {
 
     // Generate Circle Vertices
     float centerX = 0.0f, centerY = 0.0f, radius = 0.5f; // Circle in NDC
-    std::vector<float> circleVertices = generateCircleVertices(centerX, centerY, radius);
+
+    // Packed int16 pixel offsets halve the vertex buffer and leave the
+    // pixel-to-NDC transform to the vertex shader
+    const bool usePackedVertices = true;
+
+    // The ordered outline is a closed, duplicate-free loop; the plain mode
+    // emits the 8 symmetric points of each step and can only be drawn as points
+    const bool useOrderedOutline = true;
+
+    std::vector<float> circleVertices;
+    std::vector<int16_t> packedVertices;
+    if (usePackedVertices && useOrderedOutline)
+        packedVertices = generateCircleOutlinePackedVertices(0, 0, static_cast<int>(radius * 800));
+    else if (usePackedVertices)
+        packedVertices = generateCirclePackedVertices(0, 0, static_cast<int>(radius * 800));
+    else if (useOrderedOutline)
+        circleVertices = generateCircleOutlineVertices(centerX, centerY, radius);
+    else
+        circleVertices = generateCircleVertices(centerX, centerY, radius);
+    GLsizei vertexCount = static_cast<GLsizei>(usePackedVertices ? packedVertices.size() / 2 : circleVertices.size() / 2);
 
     // Create VAO and VBO for Circle
     GLuint VAO, VBO;
@@ -124,14 +1044,28 @@ int main() {
     glBindVertexArray(VAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(float), circleVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    if (usePackedVertices) {
+        glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(int16_t), packedVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 2 * sizeof(int16_t), (void*)0);
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(float), circleVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    }
     glEnableVertexAttribArray(0);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // Pixel offsets map to NDC as center + offset / 800; float vertices are already normalized
+    glUseProgram(shaderProgram);
+    if (usePackedVertices) {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f / 800.0f, 1.0f / 800.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), centerX, centerY);
+    } else {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f, 1.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), 0.0f, 0.0f);
+    }
+
     // Render Loop
     while (!glfwWindowShouldClose(window)) {
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -139,7 +1073,7 @@ int main() {
 
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO);
-        glDrawArrays(GL_POINTS, 0, circleVertices.size() / 2);
+        glDrawArrays(useOrderedOutline ? GL_LINE_LOOP : GL_POINTS, 0, vertexCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
@@ -1,13 +1,29 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define ELLIPSE_SIMD_X86 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ELLIPSE_SIMD_NEON 1
+#endif
+
 const char* vertexShaderSource = R"glsl(
     #version 330 core
     layout (location = 0) in vec2 aPos;
+    uniform vec2 uScale;
+    uniform vec2 uOffset;
     void main() {
-        gl_Position = vec4(aPos, 0.0, 1.0);
+        gl_Position = vec4(aPos * uScale + uOffset, 0.0, 1.0);
     }
 )glsl";
 
@@ -19,61 +35,865 @@ const char* fragmentShaderSource = R"glsl(
     }
 )glsl";
 
-// Midpoint Ellipse Drawing Algorithm
-std::vector<float> generateEllipseVertices(float centerX, float centerY, float rx, float ry) {
-    std::vector<float> vertices;
-
-    float x = 0.0f;
-    float y = ry;
-
-    float rxSq = rx * rx;
-    float rySq = ry * ry;
-
-    // Initial decision parameter for Region 1
-    float p1 = rySq - (rxSq * ry) + (0.25f * rxSq);
-
-    auto plotPoints = [&](float x, float y) {
-        vertices.push_back(centerX + x);
-        vertices.push_back(centerY + y);
-        vertices.push_back(centerX - x);
-        vertices.push_back(centerY + y);
-        vertices.push_back(centerX + x);
-        vertices.push_back(centerY - y);
-        vertices.push_back(centerX - x);
-        vertices.push_back(centerY - y);
-    };
+// Horizontal run of pixels on row y, inclusive on both ends
+struct HorizontalSpan {
+    int y;
+    int xStart;
+    int xEnd;
+};
+
+// Pixel sinks. The rasterizers are templates over a Sink with
+// plot(int x, int y), so the destination is inlined into the pixel loop.
+
+// Writes vertex pairs around a normalized center, one pixel = 1/800
+struct EllipseVertexSink {
+    float centerX;
+    float centerY;
+    float* out;
+
+    void plot(int x, int y) {
+        *out++ = centerX + static_cast<float>(x) / 800.0f; // Normalize points for OpenGL
+        *out++ = centerY + static_cast<float>(y) / 800.0f;
+    }
+};
+
+// Writes pixel coordinates as int16 pairs, half the size of float pairs.
+// Coordinates must fit in int16; the vertex shader maps them to NDC.
+struct PackedVertexSink {
+    int16_t* out;
+
+    void plot(int x, int y) {
+        *out++ = static_cast<int16_t>(x);
+        *out++ = static_cast<int16_t>(y);
+    }
+};
+
+// Sets pixels in an 8-bit framebuffer, skipping any outside it
+struct FramebufferSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y) {
+        if (static_cast<unsigned>(x) < static_cast<unsigned>(width) && static_cast<unsigned>(y) < static_cast<unsigned>(height))
+            pixels[static_cast<size_t>(y) * width + x] = value;
+    }
+};
+
+// Collects horizontal spans, extending the last span while pixels continue it
+struct SpanSink {
+    std::vector<HorizontalSpan>& spans;
+
+    void plot(int x, int y) {
+        if (!spans.empty()) {
+            HorizontalSpan& last = spans.back();
+            if (last.y == y && last.xEnd + 1 == x) {
+                last.xEnd = x;
+                return;
+            }
+        }
+        spans.push_back({ y, x, x });
+    }
+};
+
+// Counts pixels without storing them
+struct CountingSink {
+    size_t count = 0;
+
+    void plot(int, int) {
+        ++count;
+    }
+};
+
+// Tracks the bounding box of all plotted pixels; empty while minX > maxX
+struct BoundingBoxSink {
+    int minX = INT_MAX;
+    int minY = INT_MAX;
+    int maxX = INT_MIN;
+    int maxY = INT_MIN;
+
+    void plot(int x, int y) {
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+};
+
+// Span sinks take span(int y, int xStart, int xEnd), inclusive on both ends;
+// the filled rasterizers emit one span per row into them.
+
+// Collects spans into a vector
+struct SpanListSink {
+    std::vector<HorizontalSpan>& spans;
 
-    // Region 1
-    while ((2 * rySq * x) < (2 * rxSq * y)) {
-        plotPoints(x / 800.0f, y / 800.0f); // Normalize points for OpenGL
+    void span(int y, int xStart, int xEnd) {
+        spans.push_back({ y, xStart, xEnd });
+    }
+};
+
+// Fills spans into an 8-bit framebuffer with memset, clipped to it
+struct FramebufferSpanSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void span(int y, int xStart, int xEnd) {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        xStart = std::max(xStart, 0);
+        xEnd = std::min(xEnd, width - 1);
+        if (xStart <= xEnd)
+            std::memset(pixels + static_cast<size_t>(y) * width + xStart, value, xEnd - xStart + 1);
+    }
+};
+
+// Coverage sinks take plot(int x, int y, int alpha) with an 8-bit coverage
+// alpha in 1..255; the anti-aliased rasterizers leave out empty pixels.
+
+// Pixel with 8-bit anti-aliasing coverage
+struct CoveragePixel {
+    int x;
+    int y;
+    uint8_t alpha;
+};
+
+// Collects coverage pixels into a vector
+struct CoverageListSink {
+    std::vector<CoveragePixel>& pixels;
+
+    void plot(int x, int y, int alpha) {
+        pixels.push_back({ x, y, static_cast<uint8_t>(alpha) });
+    }
+};
+
+// v / 255 rounded to nearest, for 0 <= v <= 255 * 255, without a division
+inline int div255(int v) {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+// Blends a gray level into an 8-bit grayscale buffer by coverage, skipping
+// pixels outside it
+struct GrayscaleBlendSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y, int alpha) {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t& dst = pixels[static_cast<size_t>(y) * width + x];
+        dst = static_cast<uint8_t>(div255(dst * (255 - alpha) + value * alpha));
+    }
+};
+
+// Blends a color into a buffer of 4-byte RGBA pixels by coverage, skipping
+// pixels outside it. The four channels are widened to 16-bit lanes of one
+// vector register and blended together.
+struct RgbaBlendSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t color[4];
+
+    void plot(int x, int y, int alpha) {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t* dst = pixels + 4 * (static_cast<size_t>(y) * width + x);
+#if ELLIPSE_SIMD_X86
+        int32_t dstBits, colorBits;
+        std::memcpy(&dstBits, dst, 4);
+        std::memcpy(&colorBits, color, 4);
+        __m128i zero = _mm_setzero_si128();
+        __m128i d = _mm_unpacklo_epi8(_mm_cvtsi32_si128(dstBits), zero);
+        __m128i c = _mm_unpacklo_epi8(_mm_cvtsi32_si128(colorBits), zero);
+        __m128i v = _mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(static_cast<int16_t>(255 - alpha))),
+                                  _mm_mullo_epi16(c, _mm_set1_epi16(static_cast<int16_t>(alpha))));
+        v = _mm_add_epi16(v, _mm_set1_epi16(128));
+        v = _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+        int32_t out = _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+        std::memcpy(dst, &out, 4);
+#elif ELLIPSE_SIMD_NEON
+        uint32_t dstBits, colorBits;
+        std::memcpy(&dstBits, dst, 4);
+        std::memcpy(&colorBits, color, 4);
+        uint8x8_t d = vreinterpret_u8_u32(vdup_n_u32(dstBits));
+        uint8x8_t c = vreinterpret_u8_u32(vdup_n_u32(colorBits));
+        uint16x8_t v = vmull_u8(d, vdup_n_u8(static_cast<uint8_t>(255 - alpha)));
+        v = vmlal_u8(v, c, vdup_n_u8(static_cast<uint8_t>(alpha)));
+        v = vaddq_u16(v, vdupq_n_u16(128));
+        uint32_t out = vget_lane_u32(vreinterpret_u32_u8(vshrn_n_u16(vsraq_n_u16(v, v, 8), 8)), 0);
+        std::memcpy(dst, &out, 4);
+#else
+        for (int i = 0; i < 4; ++i)
+            dst[i] = static_cast<uint8_t>(div255(dst[i] * (255 - alpha) + color[i] * alpha));
+#endif
+    }
+};
+
+// Upper bound on the vertices generateEllipseVertices produces. Region 1
+// steps x up to about rx^2 / h and region 2 steps y down from about
+// ry^2 / h, h = hypot(rx, ry); together that is about h steps of 4 points.
+size_t ellipseVertexCount(float rx, float ry) {
+    double h = std::sqrt(static_cast<double>(rx) * rx + static_cast<double>(ry) * ry);
+    return 4 * (static_cast<size_t>(std::ceil(h)) + 2);
+}
+
+// First quadrant of the Midpoint Ellipse Drawing Algorithm, calling
+// step(x, y) for each pixel from (0, ry) to (rx, 0). The decision
+// parameters are kept in 64-bit integers: the quarter fractions of the
+// textbook p1 and p2 never change during a region, so only the integer part
+// is tracked and the sign tests account for the fraction. px = 2 * ry^2 * x
+// and py = 2 * rx^2 * y are updated by second-order differences, so the loop
+// does no multiplications. Exact for radii up to 2^20.
+template <typename StepFn>
+void midpointEllipseQuadrant(int rx, int ry, StepFn step) {
+    int x = 0;
+    int y = ry;
+
+    int64_t rxSq = static_cast<int64_t>(rx) * rx;
+    int64_t rySq = static_cast<int64_t>(ry) * ry;
+    int64_t twoRxSq = 2 * rxSq;
+    int64_t twoRySq = 2 * rySq;
+    int64_t px = 0;
+    int64_t py = twoRxSq * ry;
+
+    // Region 1: p1 = ry^2 - rx^2 * ry + rx^2 / 4. The fraction is 0 or 1/4,
+    // so p1 < 0 exactly when its integer part is.
+    int64_t p1 = rySq - rxSq * ry + rxSq / 4;
+    while (px < py) {
+        step(x, y);
         x++;
+        px += twoRySq;
         if (p1 < 0) {
-            p1 += (2 * rySq * x) + rySq;
+            p1 += px + rySq;
         } else {
             y--;
-            p1 += (2 * rySq * x) - (2 * rxSq * y) + rySq;
+            py -= twoRxSq;
+            p1 += px - py + rySq;
         }
     }
 
-    // Initial decision parameter for Region 2
-    float p2 = rySq * (x + 0.5f) * (x + 0.5f) + rxSq * (y - 1) * (y - 1) - rxSq * rySq;
+    // Region 2 starts from p2 = p1 - (px + py) / 2 + (3 * rx^2 - 3 * ry^2) / 4,
+    // which moves the midpoint from (x + 1, y - 1/2) to (x + 1/2, y - 1)
+    // without the 2^80-sized terms of evaluating p2 directly. p2 is kept as
+    // its integer part plus quarter / 4.
+    int64_t quarterSum = 3 * rxSq - 3 * rySq + rxSq % 4;
+    int64_t quarter = ((quarterSum % 4) + 4) % 4;
+    int64_t p2 = p1 - (px + py) / 2 + (quarterSum - quarter) / 4;
+    int64_t p2Threshold = quarter > 0 ? -1 : 0;
 
     // Region 2
     while (y >= 0) {
-        plotPoints(x / 800.0f, y / 800.0f); // Normalize points for OpenGL
+        step(x, y);
         y--;
-        if (p2 > 0) {
-            p2 += rxSq - (2 * rxSq * y);
+        py -= twoRxSq;
+        if (p2 > p2Threshold) {
+            p2 += rxSq - py;
         } else {
             x++;
-            p2 += (2 * rySq * x) - (2 * rxSq * y) + rxSq;
+            px += twoRySq;
+            p2 += px - py + rxSq;
         }
     }
+}
 
+// Midpoint Ellipse Drawing Algorithm, plotting the 4 symmetric points of
+// each step around (centerX, centerY) into any pixel sink
+template <typename Sink>
+void midpointEllipse(int centerX, int centerY, int rx, int ry, Sink& sink) {
+    midpointEllipseQuadrant(rx, ry, [&](int x, int y) {
+        sink.plot(centerX + x, centerY + y);
+        sink.plot(centerX - x, centerY + y);
+        sink.plot(centerX + x, centerY - y);
+        sink.plot(centerX - x, centerY - y);
+    });
+}
+
+// Filled midpoint ellipse: one span per row, covering every pixel between
+// the left and right outline pixels of midpointEllipse. The quadrant walk
+// visits rows from ry down to 0, and the last x seen on a row is its
+// half-width, so each pair of rows is emitted as soon as y moves on.
+template <typename Spans>
+void midpointEllipseFilled(int centerX, int centerY, int rx, int ry, Spans& spans) {
+    if (rx < 0 || ry < 0)
+        return;
+
+    int rowY = ry;
+    int rowHalfWidth = 0;
+    auto emitRows = [&](int y, int halfWidth) {
+        spans.span(centerY + y, centerX - halfWidth, centerX + halfWidth);
+        if (y != 0)
+            spans.span(centerY - y, centerX - halfWidth, centerX + halfWidth);
+    };
+
+    midpointEllipseQuadrant(rx, ry, [&](int x, int y) {
+        if (y != rowY) {
+            emitRows(rowY, rowHalfWidth);
+            rowY = y;
+        }
+        rowHalfWidth = x;
+    });
+    emitRows(rowY, rowHalfWidth);
+}
+
+// Midpoint Ellipse Drawing Algorithm, writing into a caller-provided buffer.
+// Radii are in pixels and truncated to whole pixels. capacity is in vertices
+// (float pairs) and must be at least ellipseVertexCount(rx, ry); returns the
+// number of vertices written, or 0 if the buffer is too small.
+size_t generateEllipseVerticesInto(float centerX, float centerY, float rx, float ry, float* out, size_t capacity) {
+    if (capacity < ellipseVertexCount(rx, ry))
+        return 0;
+
+    EllipseVertexSink sink{ centerX, centerY, out };
+    midpointEllipse(0, 0, static_cast<int>(rx), static_cast<int>(ry), sink);
+    return static_cast<size_t>(sink.out - out) / 2;
+}
+
+// Midpoint Ellipse Drawing Algorithm
+std::vector<float> generateEllipseVertices(float centerX, float centerY, float rx, float ry) {
+    std::vector<float> vertices(2 * ellipseVertexCount(rx, ry));
+    size_t count = generateEllipseVerticesInto(centerX, centerY, rx, ry, vertices.data(), vertices.size() / 2);
+    vertices.resize(2 * count);
+    return vertices;
+}
+
+// Midpoint Ellipse Drawing Algorithm, emitting packed int16 pixel coordinates
+std::vector<int16_t> generateEllipsePackedVertices(int centerX, int centerY, int rx, int ry) {
+    std::vector<int16_t> vertices(2 * ellipseVertexCount(static_cast<float>(rx), static_cast<float>(ry)));
+    PackedVertexSink sink{ vertices.data() };
+    midpointEllipse(centerX, centerY, rx, ry, sink);
+    vertices.resize(sink.out - vertices.data());
     return vertices;
 }
 
-int main() {
+// Filled midpoint ellipse as a list of spans
+std::vector<HorizontalSpan> generateFilledEllipseSpans(int centerX, int centerY, int rx, int ry) {
+    std::vector<HorizontalSpan> spans;
+    spans.reserve(2 * static_cast<size_t>(std::max(ry, 0)) + 1);
+    SpanListSink sink{ spans };
+    midpointEllipseFilled(centerX, centerY, rx, ry, sink);
+    return spans;
+}
+
+// Filled midpoint ellipse drawn straight into an 8-bit framebuffer
+void fillEllipse(int centerX, int centerY, int rx, int ry, uint8_t* pixels, int width, int height, uint8_t value) {
+    FramebufferSpanSink sink{ pixels, width, height, value };
+    midpointEllipseFilled(centerX, centerY, rx, ry, sink);
+}
+
+// Rows and 8-bit coverages of the Wu columns x = first..first + count - 1 of
+// the curve y = scale * sqrt(radiusSquared - x^2). Column x is covered by
+// the pixel pair (x, row) and (x, row + 1); the second gets alpha and the
+// first 255 - alpha.
+void wuCoverageScalar(float scale, float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    for (int i = 0; i < count; ++i) {
+        float x = static_cast<float>(first + i);
+        float y = scale * std::sqrt(std::max(radiusSquared - x * x, 0.0f));
+        float row = std::floor(y);
+        rows[i] = static_cast<int>(row);
+        alphas[i] = static_cast<uint8_t>(static_cast<int>((y - row) * 255.0f + 0.5f));
+    }
+}
+
+#if ELLIPSE_SIMD_X86
+// y is never negative, so truncation is the floor
+void wuCoverageSse(float scale, float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    const __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 vScale = _mm_set1_ps(scale), vRadiusSquared = _mm_set1_ps(radiusSquared);
+    const __m128 zero = _mm_setzero_ps(), full = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_add_ps(_mm_set1_ps(static_cast<float>(first + i)), lane);
+        __m128 y = _mm_mul_ps(vScale, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(vRadiusSquared, _mm_mul_ps(x, x)), zero)));
+        __m128i row = _mm_cvttps_epi32(y);
+        __m128i alpha = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(y, _mm_cvtepi32_ps(row)), full), half));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rows + i), row);
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(alpha, alpha), _mm_setzero_si128());
+        int four = _mm_cvtsi128_si32(packed);
+        std::memcpy(alphas + i, &four, 4);
+    }
+    wuCoverageScalar(scale, radiusSquared, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+#if ELLIPSE_SIMD_NEON && defined(__aarch64__)
+// vsqrtq needs AArch64
+void wuCoverageNeon(float scale, float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+    const float laneInit[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t lane = vld1q_f32(laneInit);
+    const float32x4_t vScale = vdupq_n_f32(scale), vRadiusSquared = vdupq_n_f32(radiusSquared);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vaddq_f32(vdupq_n_f32(static_cast<float>(first + i)), lane);
+        float32x4_t y = vmulq_f32(vScale, vsqrtq_f32(vmaxq_f32(vsubq_f32(vRadiusSquared, vmulq_f32(x, x)), vdupq_n_f32(0.0f))));
+        int32x4_t row = vcvtq_s32_f32(y);
+        int32x4_t alpha = vcvtq_s32_f32(vaddq_f32(vmulq_f32(vsubq_f32(y, vcvtq_f32_s32(row)), vdupq_n_f32(255.0f)), vdupq_n_f32(0.5f)));
+
+        vst1q_s32(rows + i, row);
+        uint8x8_t narrow = vqmovun_s16(vcombine_s16(vqmovn_s32(alpha), vdup_n_s16(0)));
+        vst1_lane_u32(reinterpret_cast<uint32_t*>(alphas + i), vreinterpret_u32_u8(narrow), 0);
+    }
+    wuCoverageScalar(scale, radiusSquared, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+void wuCoverage(float scale, float radiusSquared, int first, int count, int* rows, uint8_t* alphas) {
+#if ELLIPSE_SIMD_X86
+    wuCoverageSse(scale, radiusSquared, first, count, rows, alphas);
+#elif ELLIPSE_SIMD_NEON && defined(__aarch64__)
+    wuCoverageNeon(scale, radiusSquared, first, count, rows, alphas);
+#else
+    wuCoverageScalar(scale, radiusSquared, first, count, rows, alphas);
+#endif
+}
+
+// Xiaolin Wu anti-aliased ellipse around (centerX, centerY) with fractional
+// pixel radii of at least 1. Like the midpoint ellipse it works in two
+// regions of the first quadrant: where the curve is flatter than 45 degrees
+// each column x is covered by the two pixels straddling
+// y = ry * sqrt(1 - x^2 / rx^2), and past that each row y by the two pixels
+// straddling x = rx * sqrt(1 - y^2 / ry^2). Region 2 leaves out the columns
+// region 1 already covered, and pixels on an axis are mirrored once, so no
+// pixel is plotted twice. Region 2 runs one row past the 45 degree point:
+// that row can still reach the first column past region 1, and without it
+// the pixel where the regions meet is never plotted.
+template <typename Sink>
+void wuEllipse(int centerX, int centerY, float rx, float ry, Sink& sink) {
+    if (!(rx >= 1.0f && ry >= 1.0f))
+        return;
+
+    // The slope is -1 at (rx^2 / h, ry^2 / h), h = hypot(rx, ry)
+    double h = std::sqrt(static_cast<double>(rx) * rx + static_cast<double>(ry) * ry);
+    int lastX = static_cast<int>(static_cast<double>(rx) * rx / h);
+    int lastY = static_cast<int>(static_cast<double>(ry) * ry / h);
+
+    auto plot4 = [&](int x, int y, int alpha) {
+        if (alpha == 0)
+            return;
+        sink.plot(centerX + x, centerY + y, alpha);
+        if (x != 0)
+            sink.plot(centerX - x, centerY + y, alpha);
+        if (y != 0)
+            sink.plot(centerX + x, centerY - y, alpha);
+        if (x != 0 && y != 0)
+            sink.plot(centerX - x, centerY - y, alpha);
+    };
+
+    const int block = 64;
+    int rows[block];
+    uint8_t alphas[block];
+
+    // Region 1, column by column
+    for (int first = 0; first <= lastX; first += block) {
+        int count = std::min(block, lastX - first + 1);
+        wuCoverage(ry / rx, rx * rx, first, count, rows, alphas);
+        for (int i = 0; i < count; ++i) {
+            plot4(first + i, rows[i], 255 - alphas[i]);
+            plot4(first + i, rows[i] + 1, alphas[i]);
+        }
+    }
+
+    // Region 2, row by row; rows[] holds columns here
+    for (int first = 0; first <= lastY + 1; first += block) {
+        int count = std::min(block, lastY + 2 - first);
+        wuCoverage(rx / ry, ry * ry, first, count, rows, alphas);
+        for (int i = 0; i < count; ++i) {
+            if (rows[i] > lastX)
+                plot4(rows[i], first + i, 255 - alphas[i]);
+            if (rows[i] + 1 > lastX)
+                plot4(rows[i] + 1, first + i, alphas[i]);
+        }
+    }
+}
+
+// Anti-aliased ellipse as coverage pixels
+std::vector<CoveragePixel> generateAntialiasedEllipsePixels(int centerX, int centerY, float rx, float ry) {
+    std::vector<CoveragePixel> pixels;
+    pixels.reserve(2 * ellipseVertexCount(rx, ry));
+    CoverageListSink sink{ pixels };
+    wuEllipse(centerX, centerY, rx, ry, sink);
+    return pixels;
+}
+
+// Anti-aliased ellipse blended into an 8-bit grayscale buffer
+void blendEllipse(int centerX, int centerY, float rx, float ry, uint8_t* pixels, int width, int height, uint8_t value) {
+    GrayscaleBlendSink sink{ pixels, width, height, value };
+    wuEllipse(centerX, centerY, rx, ry, sink);
+}
+
+// Anti-aliased ellipse blended into an RGBA buffer of width * height pixels
+void blendEllipseRgba(int centerX, int centerY, float rx, float ry, uint8_t* pixels, int width, int height, const uint8_t color[4]) {
+    RgbaBlendSink sink{ pixels, width, height, { color[0], color[1], color[2], color[3] } };
+    wuEllipse(centerX, centerY, rx, ry, sink);
+}
+
+// Centered ellipse as the conic a x^2 + b x y + c y^2 = f in integers, with
+// a > 0, c > 0 and 4 a c > b^2
+struct EllipseConic {
+    int64_t a;
+    int64_t b;
+    int64_t c;
+    int64_t f;
+};
+
+// Conic of an ellipse with pixel semi-axes rx and ry, the rx axis rotated by
+// angle radians counterclockwise from +x. With R the larger semi-axis, f is
+// 2^32 R^2, so even the coefficient along the long axis, f / R^2, keeps 32
+// bits however thin the ellipse; f is capped so that no coefficient passes
+// 2^62, which only bites past R = 2^15 or when the semi-axes differ by more
+// than 2^15 times. midpointRotatedEllipse draws neither through the conic.
+//
+// Error bound: rounding, and the double arithmetic before it, moves each
+// coefficient by at most e = 2^12 (a few ulps of 2^62). At a point p of the
+// curve, |p| <= R, that changes a x^2 + b x y + c y^2 by at most
+// 3/2 e R^2, while the gradient there is at least 2 f / R since p . grad is
+// 2 f. The curve therefore moves by at most 3 e R^3 / (4 f) = 3 e R / 2^34,
+// under 1/40 pixel whenever the cap is not hit, and far less unless the
+// ellipse is both large and very thin.
+EllipseConic rotatedEllipseConic(float rx, float ry, float angle) {
+    double cosA = std::cos(static_cast<double>(angle));
+    double sinA = std::sin(static_cast<double>(angle));
+    double invRxSq = 1.0 / (static_cast<double>(rx) * rx);
+    double invRySq = 1.0 / (static_cast<double>(ry) * ry);
+    double minRSq = std::min(static_cast<double>(rx) * rx, static_cast<double>(ry) * ry);
+    double maxRSq = std::max(static_cast<double>(rx) * rx, static_cast<double>(ry) * ry);
+
+    EllipseConic conic;
+    conic.f = std::llround(std::min(std::ldexp(maxRSq, 32), std::ldexp(std::min(minRSq, 1.0), 62)));
+    double unit = static_cast<double>(conic.f);
+    conic.a = std::llround(unit * (cosA * cosA * invRxSq + sinA * sinA * invRySq));
+    conic.b = std::llround(unit * 2.0 * cosA * sinA * (invRxSq - invRySq));
+    conic.c = std::llround(unit * (sinA * sinA * invRxSq + cosA * cosA * invRySq));
+    return conic;
+}
+
+// Half-widths of the conic's bounding box, in pixels. 4 a c - b^2 cancels
+// heavily for thin ellipses, so it is formed exactly before converting.
+void conicExtent(const EllipseConic& conic, double& halfWidth, double& halfHeight) {
+    double det = static_cast<double>(4 * static_cast<__int128>(conic.a) * conic.c - static_cast<__int128>(conic.b) * conic.b);
+    halfWidth = std::sqrt(4.0 * static_cast<double>(conic.c) * conic.f / det);
+    halfHeight = std::sqrt(4.0 * static_cast<double>(conic.a) * conic.f / det);
+}
+
+// Upper bound on the points midpointConic plots: two per column and two
+// per row of the bounding box
+size_t conicPointCount(const EllipseConic& conic) {
+    double halfWidth, halfHeight;
+    conicExtent(conic, halfWidth, halfHeight);
+    return 4 * (static_cast<size_t>(halfWidth) + static_cast<size_t>(halfHeight)) + 4;
+}
+
+// For the lines x = first..last of a centered conic, the pixel y nearest
+// the upper crossing of each line, written to nearest[x - first]. The pixel
+// is the smallest y whose upper midpoint (x, y + 1/2) is outside the conic
+// and above the vertex of the conic along the line. It is tracked from line
+// to line with midpoint tests in doubled coordinates, as in the midpoint
+// ellipse: g is the conic at (2 x, 2 y + 1) and gx, gy its gradient, kept
+// up to date with first and second differences. Coefficients reach 2^62,
+// so they are widened to 128 bits along with G and its differences.
+// Swapping a and c gives the rightmost crossing of each row instead.
+void conicCrossings(__int128 a, __int128 b, __int128 c, __int128 f, int first, int last, std::vector<int>& nearest) {
+    nearest.resize(last - first + 1);
+
+    // Start from the rounded real crossing; the loop below settles it
+    int x = first;
+    double vertex = -static_cast<double>(b) * x / (2.0 * c);
+    double disc = std::max(static_cast<double>(b) * b * x * x - 4.0 * c * (a * static_cast<double>(x) * x - f), 0.0);
+    int y = static_cast<int>(std::lround(vertex + std::sqrt(disc) / (2.0 * c)));
+
+    // G(u, v) = a u^2 + b u v + c v^2 - 4 f at u = 2 x, v = 2 y + 1
+    __int128 u = 2 * static_cast<int64_t>(x), v = 2 * static_cast<int64_t>(y) + 1;
+    __int128 g = a * u * u + b * u * v + c * v * v - 4 * f;
+    __int128 gx = 2 * a * u + b * v;
+    __int128 gy = b * u + 2 * c * v;
+
+    // The midpoint at v is above the crossing; c v > -b x keeps it on the
+    // upper branch for lines that cross the conic within one pixel
+    auto above = [&](__int128 gv, __int128 vv) { return gv > 0 && c * vv > -b * x; };
+
+    for (;;) {
+        while (above(g - 2 * gy + 4 * c, v - 2)) {
+            g += -2 * gy + 4 * c;
+            gy -= 4 * c;
+            gx -= 2 * b;
+            v -= 2;
+        }
+        while (!above(g, v)) {
+            g += 2 * gy + 4 * c;
+            gy += 4 * c;
+            gx += 2 * b;
+            v += 2;
+        }
+        nearest[x - first] = static_cast<int>((v - 1) / 2);
+        if (x == last)
+            break;
+
+        ++x;
+        g += 2 * gx + 4 * a;
+        gx += 4 * a;
+        gy += 2 * b;
+    }
+}
+
+// Midpoint rasterizer for a centered ellipse in general conic form, such as
+// a rotated ellipse, around (centerX, centerY). Every column gets the pixel
+// nearest each of its two crossings with the curve, and every row likewise;
+// where the curve is flatter than 45 degrees the row pixels are among the
+// column pixels and the other way round where it is steeper, so together
+// they give the usual midpoint outline, with each pixel within half a pixel
+// of the curve along its row or column. Thin ellipses need no special
+// handling. By symmetry through the center only the upper crossings of
+// columns and right crossings of rows are tracked.
+template <typename Sink>
+void midpointConic(int centerX, int centerY, const EllipseConic& conic, Sink& sink) {
+    double halfWidth, halfHeight;
+    conicExtent(conic, halfWidth, halfHeight);
+    int columns = static_cast<int>(halfWidth);
+    int rows = static_cast<int>(halfHeight);
+
+    std::vector<int> columnY, rowX;
+    conicCrossings(conic.a, conic.b, conic.c, conic.f, -columns, columns, columnY);
+    conicCrossings(conic.c, conic.b, conic.a, conic.f, -rows, rows, rowX);
+
+    // The lower crossing of column x mirrors the upper crossing of column -x
+    auto upper = [&](int x) { return columnY[x + columns]; };
+    auto lower = [&](int x) { return -columnY[columns - x]; };
+    auto right = [&](int y) { return rowX[y + rows]; };
+    auto left = [&](int y) { return -rowX[rows - y]; };
+    auto isColumnPixel = [&](int x, int y) {
+        return x >= -columns && x <= columns && (upper(x) == y || lower(x) == y);
+    };
+
+    for (int x = -columns; x <= columns; ++x) {
+        sink.plot(centerX + x, centerY + upper(x));
+        if (lower(x) != upper(x))
+            sink.plot(centerX + x, centerY + lower(x));
+    }
+    for (int y = -rows; y <= rows; ++y) {
+        if (!isColumnPixel(right(y), y))
+            sink.plot(centerX + right(y), centerY + y);
+        if (left(y) != right(y) && !isColumnPixel(left(y), y))
+            sink.plot(centerX + left(y), centerY + y);
+    }
+}
+
+// How a rotated ellipse is drawn. Semi-axes must lie in [0, 2^15] and the
+// angle must be finite, or nothing is drawn. An ellipse more than 2^15
+// times longer than wide, which includes a zero semi-axis, is under a
+// pixel across and is drawn as the segment along its long axis; the conic
+// coefficients could not represent it within the error bound anyway.
+enum class RotatedEllipseShape { Empty, Segment, Conic };
+
+RotatedEllipseShape rotatedEllipseShape(float rx, float ry, float angle) {
+    const float maxRadius = 32768.0f;
+    if (!(rx >= 0.0f && ry >= 0.0f && rx <= maxRadius && ry <= maxRadius && std::isfinite(angle)))
+        return RotatedEllipseShape::Empty;
+    if (std::min(rx, ry) * maxRadius < std::max(rx, ry) || std::max(rx, ry) == 0.0f)
+        return RotatedEllipseShape::Segment;
+    return RotatedEllipseShape::Conic;
+}
+
+// Pixel end (ex, ey) of a collapsed ellipse's long axis; the segment runs
+// from (-ex, -ey) to (ex, ey)
+void rotatedEllipseSegmentEnd(float rx, float ry, float angle, int& ex, int& ey) {
+    double cosA = std::cos(static_cast<double>(angle));
+    double sinA = std::sin(static_cast<double>(angle));
+    if (rx >= ry) {
+        ex = static_cast<int>(std::lround(rx * cosA));
+        ey = static_cast<int>(std::lround(rx * sinA));
+    } else {
+        ex = static_cast<int>(std::lround(-ry * sinA));
+        ey = static_cast<int>(std::lround(ry * cosA));
+    }
+}
+
+// Upper bound on the points midpointRotatedEllipse plots
+size_t rotatedEllipsePointCount(float rx, float ry, float angle) {
+    RotatedEllipseShape shape = rotatedEllipseShape(rx, ry, angle);
+    if (shape == RotatedEllipseShape::Conic)
+        return conicPointCount(rotatedEllipseConic(rx, ry, angle));
+    if (shape == RotatedEllipseShape::Empty)
+        return 0;
+
+    int ex, ey;
+    rotatedEllipseSegmentEnd(rx, ry, angle, ex, ey);
+    return 2 * static_cast<size_t>(std::max(std::abs(ex), std::abs(ey))) + 1;
+}
+
+// Midpoint rasterizer for an ellipse with pixel semi-axes rx and ry rotated
+// by angle radians counterclockwise around (centerX, centerY). A collapsed
+// ellipse is its long axis, drawn with all-octant Bresenham; see
+// rotatedEllipseShape for the inputs that draw nothing.
+template <typename Sink>
+void midpointRotatedEllipse(int centerX, int centerY, float rx, float ry, float angle, Sink& sink) {
+    RotatedEllipseShape shape = rotatedEllipseShape(rx, ry, angle);
+    if (shape == RotatedEllipseShape::Conic) {
+        midpointConic(centerX, centerY, rotatedEllipseConic(rx, ry, angle), sink);
+        return;
+    }
+    if (shape == RotatedEllipseShape::Empty)
+        return;
+
+    int ex, ey;
+    rotatedEllipseSegmentEnd(rx, ry, angle, ex, ey);
+    int dx = 2 * std::abs(ex), dy = 2 * std::abs(ey);
+    int sx = ex > 0 ? 1 : -1, sy = ey > 0 ? 1 : -1;
+    int x = -ex, y = -ey;
+    int err = dx - dy;
+    for (;;) {
+        sink.plot(centerX + x, centerY + y);
+        if (x == ex && y == ey)
+            break;
+        int e2 = 2 * err;
+        if (e2 > -dy) {
+            err -= dy;
+            x += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+// Rotated midpoint ellipse as normalized vertices; radii are in pixels
+std::vector<float> generateRotatedEllipseVertices(float centerX, float centerY, float rx, float ry, float angle) {
+    std::vector<float> vertices(2 * rotatedEllipsePointCount(rx, ry, angle));
+    EllipseVertexSink sink{ centerX, centerY, vertices.data() };
+    midpointRotatedEllipse(0, 0, rx, ry, angle, sink);
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
+
+// Rotated midpoint ellipse as packed int16 pixel coordinates
+std::vector<int16_t> generateRotatedEllipsePackedVertices(int centerX, int centerY, float rx, float ry, float angle) {
+    std::vector<int16_t> vertices(2 * rotatedEllipsePointCount(rx, ry, angle));
+    PackedVertexSink sink{ vertices.data() };
+    midpointRotatedEllipse(centerX, centerY, rx, ry, angle, sink);
+    vertices.resize(sink.out - vertices.data());
+    return vertices;
+}
+
+// Checks that Wu coverage never drops along the outline: for a sweep of
+// fractional radii, every pixel whose centre lies within 0.2 of the ellipse
+// must be blended to at least 160. The distance is the first-order estimate
+// |F| / |grad F| of F = x^2 / rx^2 + y^2 / ry^2 - 1. Such a pixel is at most
+// 0.2 * sqrt(2) from the curve along its column or row, so a correct outline
+// gives it about 180 or more. Prints the result and returns whether every
+// ellipse passed.
+bool verifyWuCoverage() {
+    std::vector<std::pair<float, float>> radii = { { 147.0f, 193.4f } };
+    for (int k = 0; k < 2000; ++k)
+        radii.push_back({ 2.0f + 0.1f * (k * 37 % 2980), 2.0f + 0.1f * (k * 101 % 2980) });
+
+    size_t notches = 0;
+    for (const auto& radius : radii) {
+        double rx = radius.first, ry = radius.second;
+        int halfX = static_cast<int>(std::ceil(rx)) + 2, halfY = static_cast<int>(std::ceil(ry)) + 2;
+        int width = 2 * halfX + 1, height = 2 * halfY + 1;
+        std::vector<uint8_t> coverage(static_cast<size_t>(width) * height, 0);
+        blendEllipse(halfX, halfY, radius.first, radius.second, coverage.data(), width, height, 255);
+
+        bool ok = true;
+        auto check = [&](int x, int y) {
+            if (x < -halfX || x > halfX || y < -halfY || y > halfY)
+                return;
+            double f = x * x / (rx * rx) + y * y / (ry * ry) - 1.0;
+            double distance = std::fabs(f) / std::hypot(2.0 * x / (rx * rx), 2.0 * y / (ry * ry));
+            if (distance <= 0.2 && coverage[static_cast<size_t>(y + halfY) * width + x + halfX] < 160)
+                ok = false;
+        };
+        // Candidates near the curve, found from every column and every row
+        for (int x = -halfX; x <= halfX; ++x) {
+            int y = static_cast<int>(ry * std::sqrt(std::max(1.0 - x * x / (rx * rx), 0.0)));
+            for (int v = y - 1; v <= y + 2; ++v) {
+                check(x, v);
+                check(x, -v);
+            }
+        }
+        for (int y = -halfY; y <= halfY; ++y) {
+            int x = static_cast<int>(rx * std::sqrt(std::max(1.0 - y * y / (ry * ry), 0.0)));
+            for (int u = x - 1; u <= x + 2; ++u) {
+                check(u, y);
+                check(-u, y);
+            }
+        }
+        if (!ok)
+            ++notches;
+    }
+    std::cout << "wu ellipse: " << radii.size() << " ellipses, " << notches << " with notches" << std::endl;
+    return notches == 0;
+}
+
+// Checks rotated ellipses at the edges of their input range: collapsed
+// ones must give their long-axis segment, invalid ones nothing, and thin
+// ones their analytic bounding box to within a pixel. Prints the result and
+// returns whether every case passed.
+bool verifyRotatedEllipses() {
+    size_t cases = 0, failures = 0;
+    auto expect = [&](bool ok) {
+        ++cases;
+        if (!ok)
+            ++failures;
+    };
+
+    const float angles[] = { 0.0f, 0.3f, 0.7853982f, 1.5707964f, 2.5f, -4.0f };
+    for (float angle : angles) {
+        const float collapsed[][2] = { { 0.0f, 10.0f }, { 10.0f, 0.0f }, { 0.0f, 0.0f }, { 1e-9f, 300.0f }, { 20000.0f, 0.5f } };
+        for (const auto& radius : collapsed) {
+            std::vector<int16_t> packed = generateRotatedEllipsePackedVertices(0, 0, radius[0], radius[1], angle);
+            int ex, ey;
+            rotatedEllipseSegmentEnd(radius[0], radius[1], angle, ex, ey);
+            size_t points = packed.size() / 2;
+            bool ok = points == rotatedEllipsePointCount(radius[0], radius[1], angle) &&
+                      points == 2 * static_cast<size_t>(std::max(std::abs(ex), std::abs(ey))) + 1 &&
+                      packed[0] == -ex && packed[1] == -ey && packed[2 * points - 2] == ex && packed[2 * points - 1] == ey;
+            expect(ok);
+        }
+
+        const float invalid[][2] = { { -1.0f, 10.0f }, { 10.0f, -0.5f }, { NAN, 10.0f }, { 10.0f, NAN }, { INFINITY, 10.0f }, { 40000.0f, 10.0f } };
+        for (const auto& radius : invalid)
+            expect(generateRotatedEllipsePackedVertices(0, 0, radius[0], radius[1], angle).empty());
+        expect(generateRotatedEllipsePackedVertices(0, 0, 10.0f, 5.0f, NAN).empty());
+
+        const float thin[][2] = { { 12288.0f, 1.0f }, { 4000.0f, 1.0f }, { 30000.0f, 5.0f }, { 1.0f, 32767.0f }, { 32768.0f, 1.0f } };
+        for (const auto& radius : thin) {
+            std::vector<int16_t> packed = generateRotatedEllipsePackedVertices(0, 0, radius[0], radius[1], angle);
+            int minX = INT_MAX, maxX = INT_MIN, minY = INT_MAX, maxY = INT_MIN;
+            for (size_t i = 0; i < packed.size(); i += 2) {
+                minX = std::min<int>(minX, packed[i]);
+                maxX = std::max<int>(maxX, packed[i]);
+                minY = std::min<int>(minY, packed[i + 1]);
+                maxY = std::max<int>(maxY, packed[i + 1]);
+            }
+            double cosA = std::cos(static_cast<double>(angle)), sinA = std::sin(static_cast<double>(angle));
+            double rx = radius[0], ry = radius[1];
+            double halfWidth = std::sqrt(rx * rx * cosA * cosA + ry * ry * sinA * sinA);
+            double halfHeight = std::sqrt(rx * rx * sinA * sinA + ry * ry * cosA * cosA);
+            expect(std::fabs(maxX - halfWidth) <= 1.0 && std::fabs(-minX - halfWidth) <= 1.0 &&
+                   std::fabs(maxY - halfHeight) <= 1.0 && std::fabs(-minY - halfHeight) <= 1.0);
+        }
+    }
+    std::cout << "rotated ellipse: " << cases << " cases, " << failures << " failures" << std::endl;
+    return failures == 0;
+}
+
+int main(int argc, char** argv) {
+    // Headless checks of the anti-aliased outline and rotated ellipse edge cases
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0) {
+        bool ok = verifyWuCoverage();
+        ok = verifyRotatedEllipses() && ok;
+        return ok ? 0 : 1;
+    }
+
     // Initialize GLFW
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW" << std::endl;
@@ -123,7 +943,23 @@ int main() {
     // Generate Ellipse Vertices
     float centerX = 0.0f, centerY = 0.0f;
     float rx = 400.0f, ry = 300.0f; // Radii of the ellipse (in pixels)
-    std::vector<float> ellipseVertices = generateEllipseVertices(centerX, centerY, rx, ry);
+    float rotation = 0.0f; // Counterclockwise, in radians; nonzero uses the conic rasterizer
+
+    // Packed int16 pixel offsets halve the vertex buffer and leave the
+    // pixel-to-NDC transform to the vertex shader
+    const bool usePackedVertices = true;
+
+    std::vector<float> ellipseVertices;
+    std::vector<int16_t> packedVertices;
+    if (usePackedVertices && rotation != 0.0f)
+        packedVertices = generateRotatedEllipsePackedVertices(0, 0, rx, ry, rotation);
+    else if (usePackedVertices)
+        packedVertices = generateEllipsePackedVertices(0, 0, static_cast<int>(rx), static_cast<int>(ry));
+    else if (rotation != 0.0f)
+        ellipseVertices = generateRotatedEllipseVertices(centerX, centerY, rx, ry, rotation);
+    else
+        ellipseVertices = generateEllipseVertices(centerX, centerY, rx, ry);
+    GLsizei vertexCount = static_cast<GLsizei>(usePackedVertices ? packedVertices.size() / 2 : ellipseVertices.size() / 2);
 
     // Create VAO and VBO for Ellipse
     GLuint VAO, VBO;
@@ -133,14 +969,28 @@ int main() {
     glBindVertexArray(VAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, ellipseVertices.size() * sizeof(float), ellipseVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    if (usePackedVertices) {
+        glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(int16_t), packedVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 2 * sizeof(int16_t), (void*)0);
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, ellipseVertices.size() * sizeof(float), ellipseVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    }
     glEnableVertexAttribArray(0);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // Pixel offsets map to NDC as center + offset / 800; float vertices are already normalized
+    glUseProgram(shaderProgram);
+    if (usePackedVertices) {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f / 800.0f, 1.0f / 800.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), centerX, centerY);
+    } else {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f, 1.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), 0.0f, 0.0f);
+    }
+
     // Render Loop
     while (!glfwWindowShouldClose(window)) {
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -148,7 +998,7 @@ int main() {
 
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO);
-        glDrawArrays(GL_POINTS, 0, ellipseVertices.size() / 2);
+        glDrawArrays(GL_POINTS, 0, vertexCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
@@ -1,5 +1,13 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -32,8 +40,98 @@ GLFWwindow* initializeWindow(int width, int height, const char* title) {
     return window;
 }
 
-// Bresenham Line Algorithm for |m| < 1
-void bresenhamLineLow(int x0, int y0, int x1, int y1, std::vector<float>& vertices) {
+// Horizontal run of pixels on row y, inclusive on both ends
+struct HorizontalSpan {
+    int y;
+    int xStart;
+    int xEnd;
+};
+
+// Pixel sinks. The rasterizers are templates over a Sink with
+// plot(int x, int y), so the destination is inlined into the pixel loop.
+
+// Writes normalized (x, y) vertex pairs for the 800x800 window
+struct VertexSink {
+    float* out;
+
+    void plot(int x, int y) {
+        *out++ = (float)x / 400.0f - 1.0f; // Normalize x
+        *out++ = (float)y / 400.0f - 1.0f; // Normalize y
+    }
+};
+
+// Writes pixel coordinates as int16 pairs, half the size of float pairs.
+// Coordinates must fit in int16; the vertex shader maps them to NDC.
+struct PackedVertexSink {
+    int16_t* out;
+
+    void plot(int x, int y) {
+        *out++ = static_cast<int16_t>(x);
+        *out++ = static_cast<int16_t>(y);
+    }
+};
+
+// Sets pixels in an 8-bit framebuffer, skipping any outside it
+struct FramebufferSink {
+    uint8_t* pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y) {
+        if (static_cast<unsigned>(x) < static_cast<unsigned>(width) && static_cast<unsigned>(y) < static_cast<unsigned>(height))
+            pixels[static_cast<size_t>(y) * width + x] = value;
+    }
+};
+
+// Collects horizontal spans, extending the last span while pixels continue it
+struct SpanSink {
+    std::vector<HorizontalSpan>& spans;
+
+    void plot(int x, int y) {
+        if (!spans.empty()) {
+            HorizontalSpan& last = spans.back();
+            if (last.y == y && last.xEnd + 1 == x) {
+                last.xEnd = x;
+                return;
+            }
+        }
+        spans.push_back({ y, x, x });
+    }
+};
+
+// Counts pixels without storing them
+struct CountingSink {
+    size_t count = 0;
+
+    void plot(int, int) {
+        ++count;
+    }
+};
+
+// Tracks the bounding box of all plotted pixels; empty while minX > maxX
+struct BoundingBoxSink {
+    int minX = INT_MAX;
+    int minY = INT_MAX;
+    int maxX = INT_MIN;
+    int maxY = INT_MIN;
+
+    void plot(int x, int y) {
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+};
+
+// Number of vertices bresenhamLineLow produces: one per x step
+size_t bresenhamLineLowCount(int x0, int x1) {
+    return x1 >= x0 ? static_cast<size_t>(x1 - x0) + 1 : 0;
+}
+
+// Bresenham Line Algorithm for |m| < 1, plotting into any pixel sink
+template <typename Sink>
+void bresenhamLineLowTo(int x0, int y0, int x1, int y1, Sink& sink) {
     int dx = x1 - x0;
     int dy = y1 - y0;
     int yi = 1;
@@ -46,8 +144,351 @@ void bresenhamLineLow(int x0, int y0, int x1, int y1, std::vector<float>& vertic
     int y = y0;
 
     for (int x = x0; x <= x1; ++x) {
-        vertices.push_back((float)x / 400.0f - 1.0f); // Normalize x
-        vertices.push_back((float)y / 400.0f - 1.0f); // Normalize y
+        sink.plot(x, y);
+        if (D > 0) {
+            y += yi;
+            D -= 2 * dx;
+        }
+        D += 2 * dy;
+    }
+}
+
+// Bresenham Line Algorithm for |m| < 1, writing into a caller-provided
+// buffer. capacity is in vertices (float pairs) and must be at least
+// bresenhamLineLowCount(); returns the number of vertices written, or 0 if
+// the buffer is too small.
+size_t bresenhamLineLowInto(int x0, int y0, int x1, int y1, float* out, size_t capacity) {
+    size_t count = bresenhamLineLowCount(x0, x1);
+    if (capacity < count)
+        return 0;
+
+    VertexSink sink{ out };
+    bresenhamLineLowTo(x0, y0, x1, y1, sink);
+    return count;
+}
+
+// Bresenham Line Algorithm for |m| < 1
+void bresenhamLineLow(int x0, int y0, int x1, int y1, std::vector<float>& vertices) {
+    size_t count = bresenhamLineLowCount(x0, x1);
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * count);
+    bresenhamLineLowInto(x0, y0, x1, y1, vertices.data() + base, count);
+}
+
+// Bresenham Line Algorithm for |m| < 1, appending packed int16 pixel coordinates
+void bresenhamLineLowPacked(int x0, int y0, int x1, int y1, std::vector<int16_t>& vertices) {
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * bresenhamLineLowCount(x0, x1));
+    PackedVertexSink sink{ vertices.data() + base };
+    bresenhamLineLowTo(x0, y0, x1, y1, sink);
+}
+
+// Double-step, two-ended form of bresenhamLineLow with identical output.
+// Each iteration classifies the decision variable against three thresholds
+// to place two pixels at once, from the start and from the end. Walking
+// backwards, the pixels bresenhamLineLow produces on a tie (D == 0) are
+// reproduced by stepping on D >= 0 instead of D > 0.
+void bresenhamLineLowDoubleStep(int x0, int y0, int x1, int y1, std::vector<float>& vertices) {
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+
+    size_t count = bresenhamLineLowCount(x0, x1);
+    if (count == 0)
+        return;
+
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * count);
+    float* out = vertices.data() + base;
+
+    auto plot = [&](int i, int y) {
+        out[2 * i] = (float)(x0 + i) / 400.0f - 1.0f; // Normalize x
+        out[2 * i + 1] = (float)y / 400.0f - 1.0f;    // Normalize y
+    };
+
+    int twoStepFlat = 4 * dy;
+    int twoStepMixed = 4 * dy - 2 * dx;
+    int twoStepDiagonal = 4 * dy - 4 * dx;
+
+    int front = 0, frontY = y0, frontD = 2 * dy - dx;
+    int back = dx, backY = y1, backD = 2 * dy - dx;
+
+    while (back - front >= 3) {
+        plot(front, frontY);
+        plot(back, backY);
+
+        if (frontD <= -2 * dy) {
+            plot(front + 1, frontY);
+            frontD += twoStepFlat;
+        } else if (frontD <= 0) {
+            plot(front + 1, frontY);
+            frontY += yi;
+            frontD += twoStepMixed;
+        } else if (frontD <= 2 * dx - 2 * dy) {
+            frontY += yi;
+            plot(front + 1, frontY);
+            frontD += twoStepMixed;
+        } else {
+            frontY += yi;
+            plot(front + 1, frontY);
+            frontY += yi;
+            frontD += twoStepDiagonal;
+        }
+
+        if (backD < -2 * dy) {
+            plot(back - 1, backY);
+            backD += twoStepFlat;
+        } else if (backD < 0) {
+            plot(back - 1, backY);
+            backY -= yi;
+            backD += twoStepMixed;
+        } else if (backD < 2 * dx - 2 * dy) {
+            backY -= yi;
+            plot(back - 1, backY);
+            backD += twoStepMixed;
+        } else {
+            backY -= yi;
+            plot(back - 1, backY);
+            backY -= yi;
+            backD += twoStepDiagonal;
+        }
+
+        front += 2;
+        back -= 2;
+    }
+
+    // At most three pixels remain between the two walkers
+    for (; front <= back; ++front) {
+        plot(front, frontY);
+        if (frontD > 0) {
+            frontY += yi;
+            frontD -= 2 * dx;
+        }
+        frontD += 2 * dy;
+    }
+}
+
+// Loop state of bresenhamLineLow at a given step, before that step's pixel
+struct BresenhamLowState {
+    int x;
+    int y;
+    int64_t D;
+};
+
+// Closed-form seek into bresenhamLineLow. After i steps y has moved
+// ceil((2 * dy * i - dx) / (2 * dx)) rows, which fixes D as well.
+BresenhamLowState bresenhamLowSeek(int x0, int y0, int x1, int y1, int64_t i) {
+    int64_t dx = x1 - x0;
+    int64_t dy = y1 - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+
+    int64_t rows = dx > 0 ? (2 * dy * i + dx - 1) / (2 * dx) : 0;
+    int64_t D = 2 * dy * (i + 1) - dx - 2 * dx * rows;
+    return { x0 + static_cast<int>(i), y0 + yi * static_cast<int>(rows), D };
+}
+
+// Dash pattern as alternating on/off run lengths in pixels, starting with an
+// on run; runs needs an even count. phase is the position within the pattern
+// and advances by every step rasterized, so passing the same pattern to the
+// segments of a polyline continues the dashes across the joints.
+struct DashPattern {
+    std::vector<int> runs;
+    int64_t phase = 0;
+};
+
+// Dash pattern repeating a 32-pixel bitmask, bit 0 first
+DashPattern dashPatternFromMask(uint32_t mask) {
+    DashPattern dash;
+    int bit = 0;
+    while (bit < 32) {
+        bool on = dash.runs.size() % 2 == 0;
+        int run = 0;
+        while (bit < 32 && (((mask >> bit) & 1u) != 0) == on) {
+            ++run;
+            ++bit;
+        }
+        dash.runs.push_back(run);
+    }
+    if (dash.runs.size() % 2 != 0)
+        dash.runs.push_back(0);
+    return dash;
+}
+
+// Calls onRun(first, last) for every on run covering steps [begin, count),
+// jumping whole off runs without visiting their steps, then advances the
+// phase past the steps covered. A pattern with no length is solid.
+template <typename RunFn>
+void forEachDashRun(DashPattern& dash, int64_t begin, int64_t count, RunFn onRun) {
+    int64_t period = 0;
+    for (int run : dash.runs)
+        period += run;
+    if (begin >= count)
+        return;
+    if (period == 0) {
+        onRun(begin, count - 1);
+        return;
+    }
+
+    // Locate the run containing the current phase
+    int64_t offset = dash.phase % period;
+    size_t run = 0;
+    while (offset >= dash.runs[run]) {
+        offset -= dash.runs[run];
+        ++run;
+    }
+    int64_t remaining = dash.runs[run] - offset;
+
+    for (int64_t i = begin; i < count;) {
+        int64_t len = std::min(remaining, count - i);
+        if (run % 2 == 0 && len > 0)
+            onRun(i, i + len - 1);
+        i += len;
+        run = (run + 1) % dash.runs.size();
+        remaining = dash.runs[run];
+    }
+    dash.phase = (dash.phase + count - begin) % period;
+}
+
+// Dashed bresenhamLineLow: plots only the pixels of the pattern's on runs.
+// Each on run starts from bresenhamLowSeek, so off runs cost O(1) however
+// long they are, and the pixels plotted are exactly those of the solid line.
+template <typename Sink>
+void bresenhamLineLowDashed(int x0, int y0, int x1, int y1, DashPattern& dash, Sink& sink) {
+    int64_t dx = x1 - x0;
+    int64_t dy = y1 - y0 < 0 ? y0 - y1 : y1 - y0;
+    int yi = y1 < y0 ? -1 : 1;
+
+    auto plotRun = [&](int64_t first, int64_t last) {
+        BresenhamLowState state = bresenhamLowSeek(x0, y0, x1, y1, first);
+        int y = state.y;
+        int64_t D = state.D;
+        for (int64_t i = first; i <= last; ++i) {
+            sink.plot(x0 + static_cast<int>(i), y);
+            if (D > 0) {
+                y += yi;
+                D -= 2 * dx;
+            }
+            D += 2 * dy;
+        }
+    };
+    forEachDashRun(dash, 0, static_cast<int64_t>(bresenhamLineLowCount(x0, x1)), plotRun);
+}
+
+// Dashed bresenhamLineLow, appending normalized vertices
+void bresenhamLineLowDashed(int x0, int y0, int x1, int y1, DashPattern& dash, std::vector<float>& vertices) {
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * bresenhamLineLowCount(x0, x1));
+    VertexSink sink{ vertices.data() + base };
+    bresenhamLineLowDashed(x0, y0, x1, y1, dash, sink);
+    vertices.resize(sink.out - vertices.data());
+}
+
+// bresenhamLineLow split across threads. Each thread seeks to the start of
+// its chunk and writes into its slice of the pre-sized output, so the
+// result is identical to the serial loop.
+void bresenhamLineLowParallel(int x0, int y0, int x1, int y1, std::vector<float>& vertices, unsigned threadCount = 0) {
+    int64_t count = static_cast<int64_t>(x1) - x0 + 1;
+    if (count <= 0)
+        return;
+
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    // Short lines are not worth a thread start
+    const int64_t minChunk = 1 << 16;
+    int64_t chunks = std::min<int64_t>(threadCount, (count + minChunk - 1) / minChunk);
+
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * static_cast<size_t>(count));
+    float* out = vertices.data() + base;
+
+    int64_t dx = x1 - x0;
+    int64_t dy = y1 - y0 < 0 ? y0 - y1 : y1 - y0;
+    int yi = y1 < y0 ? -1 : 1;
+
+    auto rasterizeChunk = [=](int64_t begin, int64_t end) {
+        BresenhamLowState state = bresenhamLowSeek(x0, y0, x1, y1, begin);
+        int y = state.y;
+        int64_t D = state.D;
+        for (int64_t i = begin; i < end; ++i) {
+            out[2 * i] = (float)(x0 + i) / 400.0f - 1.0f; // Normalize x
+            out[2 * i + 1] = (float)y / 400.0f - 1.0f;    // Normalize y
+            if (D > 0) {
+                y += yi;
+                D -= 2 * dx;
+            }
+            D += 2 * dy;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for (int64_t c = 1; c < chunks; ++c)
+        workers.emplace_back(rasterizeChunk, count * c / chunks, count * (c + 1) / chunks);
+    rasterizeChunk(0, count / chunks);
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+// Inclusive pixel rectangle: the viewport or a tile
+struct ClipRect {
+    int xMin, yMin;
+    int xMax, yMax;
+};
+
+// First step of bresenhamLineLow that lands on row k (k rows from y0)
+inline int64_t bresenhamLowRowStart(int64_t dx, int64_t dy, int64_t k) {
+    return k <= 0 ? 0 : (2 * dx * k - dx) / (2 * dy) + 1;
+}
+
+// bresenhamLineLow clipped to a rectangle. The visible step range is the
+// intersection of the x range and the steps whose row lies inside, found
+// from the closed-form row starts; the loop then seeks to the first visible
+// step. Plots exactly the unclipped pixels that fall inside the rectangle.
+template <typename Sink>
+void bresenhamLineLowClipped(int x0, int y0, int x1, int y1, const ClipRect& clip, Sink& sink) {
+    int64_t dx = static_cast<int64_t>(x1) - x0;
+    int64_t dy = static_cast<int64_t>(y1) - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+
+    // Steps whose x is inside
+    int64_t first = std::max<int64_t>(0, static_cast<int64_t>(clip.xMin) - x0);
+    int64_t last = std::min<int64_t>(dx, static_cast<int64_t>(clip.xMax) - x0);
+
+    // Rows (counted from y0 in the direction of travel) whose y is inside
+    int64_t rowLo = yi > 0 ? static_cast<int64_t>(clip.yMin) - y0 : static_cast<int64_t>(y0) - clip.yMax;
+    int64_t rowHi = yi > 0 ? static_cast<int64_t>(clip.yMax) - y0 : static_cast<int64_t>(y0) - clip.yMin;
+    rowLo = std::max<int64_t>(rowLo, 0);
+    rowHi = std::min<int64_t>(rowHi, dy);
+    if (rowLo > rowHi)
+        return;
+
+    if (dy > 0) {
+        first = std::max(first, bresenhamLowRowStart(dx, dy, rowLo));
+        if (rowHi < dy)
+            last = std::min(last, bresenhamLowRowStart(dx, dy, rowHi + 1) - 1);
+    }
+    if (first > last)
+        return;
+
+    BresenhamLowState state = bresenhamLowSeek(x0, y0, x1, y1, first);
+    int y = state.y;
+    int64_t D = state.D;
+    for (int64_t i = first; i <= last; ++i) {
+        sink.plot(x0 + static_cast<int>(i), y);
         if (D > 0) {
             y += yi;
             D -= 2 * dx;
@@ -56,7 +497,531 @@ void bresenhamLineLow(int x0, int y0, int x1, int y1, std::vector<float>& vertic
     }
 }
 
-int main() {
+// Run-slice form of bresenhamLineLow: one span per row, same pixels. Row k
+// begins at step floor((2k - 1) * dx / (2 * dy)) + 1, so each run length is
+// dx / dy or one more, and only that choice is decided per run. Like
+// bresenhamLineLow, emits nothing when x1 < x0.
+void bresenhamSpansLow(int x0, int y0, int x1, int y1, std::vector<HorizontalSpan>& spans) {
+    if (x1 < x0)
+        return;
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+
+    if (dy == 0) {
+        spans.push_back({ y0, x0, x1 });
+        return;
+    }
+
+    spans.reserve(spans.size() + dy + 1);
+
+    int den = 2 * dy;
+    int run = dx / dy;
+    int runError = 2 * dx - run * den;
+
+    int y = y0;
+    int xStart = x0;
+    int nextStart = x0 + dx / den + 1;
+    int error = dx % den;
+
+    for (int k = 0; k < dy; ++k) {
+        spans.push_back({ y, xStart, nextStart - 1 });
+        y += yi;
+        xStart = nextStart;
+        nextStart += run;
+        error += runError;
+        if (error >= den) {
+            ++nextStart;
+            error -= den;
+        }
+    }
+    spans.push_back({ y, xStart, x1 });
+}
+
+// Fills spans into an 8-bit framebuffer; spans must lie inside it
+void fillSpans(const std::vector<HorizontalSpan>& spans, uint8_t* framebuffer, int width, uint8_t value) {
+    for (const HorizontalSpan& span : spans)
+        std::memset(framebuffer + static_cast<size_t>(span.y) * width + span.xStart, value, span.xEnd - span.xStart + 1);
+}
+
+// Integer pixel and segment types used by the batch rasterizer
+struct Pixel {
+    int x;
+    int y;
+};
+
+struct Segment {
+    int x0, y0;
+    int x1, y1;
+};
+
+// Writes Pixel structs
+struct PixelSink {
+    Pixel* out;
+
+    void plot(int x, int y) {
+        *out++ = { x, y };
+    }
+};
+
+// Single-octant Bresenham kernel. The octant is fixed at compile time so the
+// loop carries no direction checks and the y/x step is branch-free.
+template <bool Steep, int Xi, int Yi, typename Sink>
+void bresenhamOctant(const Segment& s, Sink& sink) {
+    int dMajor = Steep ? (s.y1 - s.y0) * Yi : (s.x1 - s.x0) * Xi;
+    int dMinor = Steep ? (s.x1 - s.x0) * Xi : (s.y1 - s.y0) * Yi;
+
+    int D = 2 * dMinor - dMajor;
+    int x = s.x0;
+    int y = s.y0;
+
+    for (int i = 0; i <= dMajor; ++i) {
+        sink.plot(x, y);
+        int step = D > 0;
+        D += 2 * dMinor - step * 2 * dMajor;
+        if (Steep) {
+            x += step * Xi;
+            y += Yi;
+        } else {
+            y += step * Yi;
+            x += Xi;
+        }
+    }
+}
+
+// Batch form of bresenhamOctant writing into a pixel buffer
+template <bool Steep, int Xi, int Yi>
+void bresenhamOctantInto(const Segment& s, Pixel* out) {
+    PixelSink sink{ out };
+    bresenhamOctant<Steep, Xi, Yi>(s, sink);
+}
+
+// Octant index: bit 2 = steep, bit 1 = x decreasing, bit 0 = y decreasing
+inline int segmentOctant(const Segment& s) {
+    int dx = s.x1 - s.x0;
+    int dy = s.y1 - s.y0;
+    int adx = dx < 0 ? -dx : dx;
+    int ady = dy < 0 ? -dy : dy;
+    return ((ady > adx) << 2) | ((dx < 0) << 1) | (dy < 0);
+}
+
+inline size_t segmentPixelCount(const Segment& s) {
+    int dx = s.x1 - s.x0;
+    int dy = s.y1 - s.y0;
+    int adx = dx < 0 ? -dx : dx;
+    int ady = dy < 0 ? -dy : dy;
+    return static_cast<size_t>(adx > ady ? adx : ady) + 1;
+}
+
+// Exact number of pixels bresenhamBatch writes for the given segments
+size_t bresenhamBatchCount(const Segment* segments, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i)
+        total += segmentPixelCount(segments[i]);
+    return total;
+}
+
+// All-octant batch Bresenham. Every segment is rasterized from (x0, y0) to
+// (x1, y1) into `out`, which must hold bresenhamBatchCount() pixels. Pixels of
+// segment i start at offsets[i]; offsets needs count + 1 entries and its last
+// entry is the total. Segments are bucketed by octant first so each kernel
+// runs over a whole bucket without per-segment dispatch.
+void bresenhamBatch(const Segment* segments, size_t count, Pixel* out, size_t* offsets) {
+    using Kernel = void (*)(const Segment&, Pixel*);
+    static const Kernel kernels[8] = {
+        bresenhamOctantInto<false, 1, 1>,  bresenhamOctantInto<false, 1, -1>,
+        bresenhamOctantInto<false, -1, 1>, bresenhamOctantInto<false, -1, -1>,
+        bresenhamOctantInto<true, 1, 1>,   bresenhamOctantInto<true, 1, -1>,
+        bresenhamOctantInto<true, -1, 1>,  bresenhamOctantInto<true, -1, -1>,
+    };
+
+    // Output offsets in input order, and a counting sort of segment indices by octant
+    std::vector<uint32_t> order(count);
+    std::vector<uint8_t> octants(count);
+    size_t bucketStart[9] = {};
+
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; ++i) {
+        octants[i] = static_cast<uint8_t>(segmentOctant(segments[i]));
+        ++bucketStart[octants[i] + 1];
+        offsets[i + 1] = offsets[i] + segmentPixelCount(segments[i]);
+    }
+    for (int o = 0; o < 8; ++o)
+        bucketStart[o + 1] += bucketStart[o];
+
+    size_t fill[8];
+    for (int o = 0; o < 8; ++o)
+        fill[o] = bucketStart[o];
+    for (size_t i = 0; i < count; ++i)
+        order[fill[octants[i]]++] = static_cast<uint32_t>(i);
+
+    for (int o = 0; o < 8; ++o) {
+        Kernel kernel = kernels[o];
+        for (size_t k = bucketStart[o]; k < bucketStart[o + 1]; ++k) {
+            uint32_t i = order[k];
+            kernel(segments[i], out + offsets[i]);
+        }
+    }
+}
+
+// Convenience wrapper returning one contiguous pixel stream for all segments
+std::vector<Pixel> bresenhamBatch(const std::vector<Segment>& segments, std::vector<size_t>& offsets) {
+    std::vector<Pixel> pixels(bresenhamBatchCount(segments.data(), segments.size()));
+    offsets.resize(segments.size() + 1);
+    bresenhamBatch(segments.data(), segments.size(), pixels.data(), offsets.data());
+    return pixels;
+}
+
+// All-octant Bresenham from (x0, y0) to (x1, y1) into any pixel sink,
+// dispatching to the same octant kernels as bresenhamBatch
+template <typename Sink>
+void bresenhamLineTo(int x0, int y0, int x1, int y1, Sink& sink) {
+    using Kernel = void (*)(const Segment&, Sink&);
+    static const Kernel kernels[8] = {
+        bresenhamOctant<false, 1, 1, Sink>,  bresenhamOctant<false, 1, -1, Sink>,
+        bresenhamOctant<false, -1, 1, Sink>, bresenhamOctant<false, -1, -1, Sink>,
+        bresenhamOctant<true, 1, 1, Sink>,   bresenhamOctant<true, 1, -1, Sink>,
+        bresenhamOctant<true, -1, 1, Sink>,  bresenhamOctant<true, -1, -1, Sink>,
+    };
+
+    Segment s{ x0, y0, x1, y1 };
+    kernels[segmentOctant(s)](s, sink);
+}
+
+// Widens the [left, right] extent of each row to cover every plotted pixel;
+// row y is stored at index y - yMin
+struct RowExtentSink {
+    int yMin;
+    int* left;
+    int* right;
+
+    void plot(int x, int y) {
+        int row = y - yMin;
+        left[row] = std::min(left[row], x);
+        right[row] = std::max(right[row], x);
+    }
+};
+
+// Appends one span per row of a convex polygon. The outline is walked with
+// Bresenham, so each row covers exactly the pixels between its outermost
+// edge pixels and neighbouring pieces sharing a vertex meet without gaps.
+void convexPolygonSpans(const Pixel* vertices, int count, std::vector<HorizontalSpan>& spans) {
+    int yMin = vertices[0].y;
+    int yMax = vertices[0].y;
+    for (int i = 1; i < count; ++i) {
+        yMin = std::min(yMin, vertices[i].y);
+        yMax = std::max(yMax, vertices[i].y);
+    }
+
+    std::vector<int> left(yMax - yMin + 1, INT_MAX);
+    std::vector<int> right(yMax - yMin + 1, INT_MIN);
+    RowExtentSink sink{ yMin, left.data(), right.data() };
+    for (int i = 0; i < count; ++i) {
+        Pixel a = vertices[i];
+        Pixel b = vertices[(i + 1) % count];
+        // Walk every edge top-down so an edge shared by two pieces, or the
+        // two sides of a degenerate one, always picks the same pixels
+        if (b.y < a.y || (b.y == a.y && b.x < a.x))
+            std::swap(a, b);
+        bresenhamLineTo(a.x, a.y, b.x, b.y, sink);
+    }
+
+    for (int row = 0; row <= yMax - yMin; ++row)
+        spans.push_back({ yMin + row, left[row], right[row] });
+}
+
+// Appends the spans of a filled disc the given number of pixels across. Odd
+// diameters are centred on (centerX, centerY) and a midpoint circle walk gives
+// the half-width of every row from one octant. Even diameters are centred on
+// the pixel corner at (centerX + 0.5, centerY + 0.5); in doubled coordinates
+// relative to that corner pixel centres sit on odd X and Y, and a pixel is
+// inside when X^2 + Y^2 <= diameter^2.
+void discSpans(int centerX, int centerY, int diameter, std::vector<HorizontalSpan>& spans) {
+    if (diameter % 2 == 0) {
+        int limit = diameter * diameter;
+        int X = diameter - 1;
+        for (int Y = 1; Y < diameter; Y += 2) {
+            while (X * X + Y * Y > limit)
+                X -= 2;
+            spans.push_back({ centerY + (1 - Y) / 2, centerX + (1 - X) / 2, centerX + (X + 1) / 2 });
+            spans.push_back({ centerY + (Y + 1) / 2, centerX + (1 - X) / 2, centerX + (X + 1) / 2 });
+        }
+        return;
+    }
+
+    int r = diameter / 2;
+    std::vector<int> halfWidth(r + 1, 0);
+    int x = 0;
+    int y = r;
+    int d = 1 - r;
+    while (x <= y) {
+        halfWidth[y] = std::max(halfWidth[y], x);
+        halfWidth[x] = std::max(halfWidth[x], y);
+        ++x;
+        if (d < 0) {
+            d += 2 * x + 1;
+        } else {
+            --y;
+            d += 2 * (x - y) + 1;
+        }
+    }
+
+    for (int dy = -r; dy <= r; ++dy) {
+        int h = halfWidth[dy < 0 ? -dy : dy];
+        spans.push_back({ centerY + dy, centerX - h, centerX + h });
+    }
+}
+
+enum class LineJoin { Miter, Round, Bevel };
+enum class LineCap { Butt, Square, Round };
+
+// Thick polyline rasterizer. The stroke is split into convex pieces (one quad
+// per segment, a wedge or disc per join, a disc per round cap), each piece is
+// scan-converted with the integer Bresenham core, and the pieces are merged
+// into non-overlapping horizontal spans sorted by row then x, ready for
+// fillSpans. The width is rounded to a whole number of pixels w and pixels
+// within about (w - 1) / 2 of the centerline are covered, so an axis-aligned
+// stroke is exactly w pixels wide and width 1 gives a one-pixel Bresenham
+// line. An even width has no centre pixel, so its centerline runs through
+// pixel corners, half a pixel towards +x and +y of the given points, and the
+// extra pixel always lands on that side. Miter joins longer than miterLimit
+// times the half width fall back to bevel. Spans are appended.
+void thickPolylineSpans(const Pixel* points, size_t count, float width, LineJoin join, LineCap cap,
+                        std::vector<HorizontalSpan>& spans, float miterLimit = 4.0f) {
+    // Drop repeated points so every segment has a direction
+    std::vector<Pixel> pts;
+    pts.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (pts.empty() || pts.back().x != points[i].x || pts.back().y != points[i].y)
+            pts.push_back(points[i]);
+    }
+    if (pts.empty())
+        return;
+
+    int w = std::max(1, static_cast<int>(std::lround(width)));
+    float h = (w - 1) * 0.5f;
+    float bias = w % 2 == 0 ? 0.5f : 0.0f;
+    int rLow = (w - 1) / 2;
+    size_t n = pts.size();
+
+    auto offset = [](const Pixel& p, float dx, float dy) {
+        return Pixel{ static_cast<int>(std::lround(p.x + dx)), static_cast<int>(std::lround(p.y + dy)) };
+    };
+
+    std::vector<HorizontalSpan> pieces;
+
+    if (n == 1) {
+        // A lone point has no direction; round and square caps still give it area
+        const Pixel& p = pts[0];
+        if (cap == LineCap::Round) {
+            discSpans(p.x, p.y, w, pieces);
+        } else if (cap == LineCap::Square) {
+            for (int y = p.y - rLow; y < p.y - rLow + w; ++y)
+                pieces.push_back({ y, p.x - rLow, p.x - rLow + w - 1 });
+        }
+    }
+
+    // Unit direction of each segment
+    std::vector<float> ux(n - 1);
+    std::vector<float> uy(n - 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        float dx = static_cast<float>(pts[i + 1].x - pts[i].x);
+        float dy = static_cast<float>(pts[i + 1].y - pts[i].y);
+        float len = std::sqrt(dx * dx + dy * dy);
+        ux[i] = dx / len;
+        uy[i] = dy / len;
+    }
+
+    // Segment bodies; square caps push the two outer ends out by the half width.
+    // Only the part of the even-width bias across the segment is applied, so
+    // butt ends stay on the endpoints and axis-aligned corners land on whole
+    // pixels instead of rounding ties.
+    for (size_t i = 0; i + 1 < n; ++i) {
+        float across = bias * (ux[i] - uy[i]);
+        float bx = -uy[i] * across;
+        float by = ux[i] * across;
+        float nx = -uy[i] * h;
+        float ny = ux[i] * h;
+        float sx0 = 0.0f, sy0 = 0.0f, sx1 = 0.0f, sy1 = 0.0f;
+        if (cap == LineCap::Square) {
+            // The bias along the segment moves the extra pixel of an even
+            // width to the +x / +y end
+            float along = bias * (ux[i] + uy[i]);
+            if (i == 0) {
+                sx0 = ux[i] * (along - h);
+                sy0 = uy[i] * (along - h);
+            }
+            if (i + 2 == n) {
+                sx1 = ux[i] * (along + h);
+                sy1 = uy[i] * (along + h);
+            }
+        }
+        const Pixel& a = pts[i];
+        const Pixel& b = pts[i + 1];
+        Pixel quad[4] = {
+            offset(a, bx + nx + sx0, by + ny + sy0), offset(b, bx + nx + sx1, by + ny + sy1),
+            offset(b, bx - nx + sx1, by - ny + sy1), offset(a, bx - nx + sx0, by - ny + sy0),
+        };
+        convexPolygonSpans(quad, 4, pieces);
+    }
+
+    if (cap == LineCap::Round && n > 1) {
+        discSpans(pts[0].x, pts[0].y, w, pieces);
+        discSpans(pts[n - 1].x, pts[n - 1].y, w, pieces);
+    }
+
+    // Joins fill the wedge left open on the outer side of each turn
+    for (size_t i = 1; i + 1 < n; ++i) {
+        const Pixel& p = pts[i];
+        if (join == LineJoin::Round) {
+            discSpans(p.x, p.y, w, pieces);
+            continue;
+        }
+
+        float cross = ux[i - 1] * uy[i] - uy[i - 1] * ux[i];
+        float dot = ux[i - 1] * ux[i] + uy[i - 1] * uy[i];
+        if (std::fabs(cross) < 1e-6f)
+            continue;
+
+        // Turning towards the left normal opens the gap on the right side
+        float s = cross > 0.0f ? -h : h;
+        float nax = -uy[i - 1], nay = ux[i - 1];
+        float nbx = -uy[i], nby = ux[i];
+        Pixel a = offset(p, bias + s * nax, bias + s * nay);
+        Pixel b = offset(p, bias + s * nbx, bias + s * nby);
+
+        // Miter length over half width is sqrt(2 / (1 + dot))
+        if (join == LineJoin::Miter && 2.0f <= miterLimit * miterLimit * (1.0f + dot)) {
+            float k = s / (1.0f + dot);
+            Pixel m = offset(p, bias + k * (nax + nbx), bias + k * (nay + nby));
+            Pixel wedge[4] = { p, a, m, b };
+            convexPolygonSpans(wedge, 4, pieces);
+        } else {
+            Pixel wedge[3] = { p, a, b };
+            convexPolygonSpans(wedge, 3, pieces);
+        }
+    }
+
+    // Union of the pieces: sort by row then start, and merge runs that overlap or touch
+    std::sort(pieces.begin(), pieces.end(), [](const HorizontalSpan& a, const HorizontalSpan& b) {
+        return a.y != b.y ? a.y < b.y : a.xStart < b.xStart;
+    });
+
+    size_t first = spans.size();
+    spans.reserve(first + pieces.size());
+    for (const HorizontalSpan& span : pieces) {
+        if (spans.size() > first) {
+            HorizontalSpan& last = spans.back();
+            if (last.y == span.y && span.xStart <= last.xEnd + 1) {
+                last.xEnd = std::max(last.xEnd, span.xEnd);
+                continue;
+            }
+        }
+        spans.push_back(span);
+    }
+}
+
+// Thick single line from (x0, y0) to (x1, y1); see thickPolylineSpans
+void thickLineSpans(int x0, int y0, int x1, int y1, float width, LineCap cap, std::vector<HorizontalSpan>& spans) {
+    Pixel points[2] = { { x0, y0 }, { x1, y1 } };
+    thickPolylineSpans(points, 2, width, LineJoin::Miter, cap, spans);
+}
+
+// Checks bresenhamLineLowDoubleStep against bresenhamLineLow, vertex for
+// vertex, over every line with |dy| <= dx up to 300 pixels long from a few
+// start points, plus reversed endpoints. Prints the result and returns
+// whether every line matched.
+bool verifyDoubleStep() {
+    const int starts[3][2] = { { 0, 0 }, { 3, -7 }, { -250, 120 } };
+    size_t lines = 0, mismatches = 0;
+    std::vector<float> expected, actual;
+    for (const auto& start : starts) {
+        for (int dx = -3; dx <= 300; ++dx) {
+            int maxDy = std::max(dx, 3);
+            for (int dy = -maxDy; dy <= maxDy; ++dy) {
+                expected.clear();
+                actual.clear();
+                bresenhamLineLow(start[0], start[1], start[0] + dx, start[1] + dy, expected);
+                bresenhamLineLowDoubleStep(start[0], start[1], start[0] + dx, start[1] + dy, actual);
+                ++lines;
+                if (expected != actual)
+                    ++mismatches;
+            }
+        }
+    }
+    std::cout << "double-step: " << lines << " lines, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// Checks bresenhamBatch against bresenhamLineLow in every octant. Each
+// segment's reference is bresenhamLineLowTo run on coordinates mirrored and,
+// for steep segments, transposed into the |m| < 1, x-increasing octant, then
+// mapped back. All segments up to 48 pixels from a few start points go
+// through one batch call, so the octant bucketing and offsets are covered too.
+bool verifyBatch() {
+    // Maps reference pixels back out of the canonical octant
+    struct OctantSink {
+        std::vector<Pixel>& pixels;
+        bool transposed;
+        int xi;
+        int yi;
+
+        void plot(int u, int v) {
+            Pixel p = transposed ? Pixel{ v, u } : Pixel{ u, v };
+            pixels.push_back({ p.x * xi, p.y * yi });
+        }
+    };
+
+    const int starts[3][2] = { { 0, 0 }, { 3, -7 }, { -250, 120 } };
+    std::vector<Segment> segments;
+    for (const auto& start : starts)
+        for (int dx = -48; dx <= 48; ++dx)
+            for (int dy = -48; dy <= 48; ++dy)
+                segments.push_back({ start[0], start[1], start[0] + dx, start[1] + dy });
+
+    std::vector<size_t> offsets;
+    std::vector<Pixel> pixels = bresenhamBatch(segments, offsets);
+
+    size_t mismatches = 0;
+    std::vector<Pixel> expected;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const Segment& s = segments[i];
+        int xi = s.x1 >= s.x0 ? 1 : -1;
+        int yi = s.y1 >= s.y0 ? 1 : -1;
+        bool steep = (s.y1 - s.y0) * yi > (s.x1 - s.x0) * xi;
+
+        expected.clear();
+        if (steep) {
+            OctantSink sink{ expected, true, 1, yi };
+            bresenhamLineLowTo(s.y0 * yi, s.x0, s.y1 * yi, s.x1, sink);
+        } else {
+            OctantSink sink{ expected, false, xi, 1 };
+            bresenhamLineLowTo(s.x0 * xi, s.y0, s.x1 * xi, s.y1, sink);
+        }
+
+        bool match = expected.size() == offsets[i + 1] - offsets[i];
+        for (size_t k = 0; match && k < expected.size(); ++k)
+            match = expected[k].x == pixels[offsets[i] + k].x && expected[k].y == pixels[offsets[i] + k].y;
+        if (!match)
+            ++mismatches;
+    }
+    std::cout << "batch: " << segments.size() << " segments, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+    // Headless equivalence checks of the double-step and batch rasterizers
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0) {
+        bool ok = verifyDoubleStep();
+        ok = verifyBatch() && ok;
+        return ok ? 0 : 1;
+    }
+
     // Initialize window
     GLFWwindow* window = initializeWindow(800, 800, "Bresenham Line |m| < 1");
     if (!window) return -1;
@@ -64,8 +1029,10 @@ int main() {
     // Shader sources
     const char* vertexShaderSource = "#version 330 core\n"
                                      "layout (location = 0) in vec2 aPos;\n"
+                                     "uniform vec2 uScale;\n"
+                                     "uniform vec2 uOffset;\n"
                                      "void main() {\n"
-                                     "   gl_Position = vec4(aPos, 0.0, 1.0);\n"
+                                     "   gl_Position = vec4(aPos * uScale + uOffset, 0.0, 1.0);\n"
                                      "}\n";
     const char* fragmentShaderSource = "#version 330 core\n"
                                        "out vec4 FragColor;\n"
@@ -90,9 +1057,18 @@ int main() {
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    // Packed int16 pixel coordinates halve the vertex buffer and leave the
+    // pixel-to-NDC transform to the vertex shader
+    const bool usePackedVertices = true;
+
     // coordinates
     std::vector<float> lineVertices;
-    bresenhamLineLow(100, 100, 500, 500, lineVertices); // Example line
+    std::vector<int16_t> packedVertices;
+    if (usePackedVertices)
+        bresenhamLineLowPacked(100, 100, 500, 500, packedVertices); // Example line
+    else
+        bresenhamLineLow(100, 100, 500, 500, lineVertices); // Example line
+    GLsizei vertexCount = static_cast<GLsizei>(usePackedVertices ? packedVertices.size() / 2 : lineVertices.size() / 2);
 
     // Create VAO and VBO
     GLuint VAO, VBO;
@@ -101,12 +1077,27 @@ int main() {
 
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    if (usePackedVertices) {
+        glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(int16_t), packedVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 2 * sizeof(int16_t), (void*)0);
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    }
     glEnableVertexAttribArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // Pixel coordinates map to NDC as x / 400 - 1; float vertices are already normalized
+    glUseProgram(shaderProgram);
+    if (usePackedVertices) {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f / 400.0f, 1.0f / 400.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), -1.0f, -1.0f);
+    } else {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f, 1.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), 0.0f, 0.0f);
+    }
+
     // Render loop
     while (!glfwWindowShouldClose(window)) {
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -115,7 +1106,7 @@ int main() {
         // Draw lines
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO);
-        glDrawArrays(GL_LINE_STRIP, 0, lineVertices.size() / 2);
+        glDrawArrays(GL_LINE_STRIP, 0, vertexCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
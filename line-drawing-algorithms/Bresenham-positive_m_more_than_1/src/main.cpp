@@ -1,5 +1,10 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -36,7 +41,114 @@ GLFWwindow *initializeWindow(int width, int height, const char *title)
     return window;
 }
 
-void bresenhamLineHigh(int x0, int y0, int x1, int y1, std::vector<float> &vertices)
+// Vertical run of pixels in column x, inclusive on both ends
+struct VerticalSpan
+{
+    int x;
+    int yStart;
+    int yEnd;
+};
+
+// Pixel sinks. The rasterizers are templates over a Sink with
+// plot(int x, int y), so the destination is inlined into the pixel loop.
+
+// Writes normalized (x, y) vertex pairs for the 800x800 window
+struct VertexSink
+{
+    float *out;
+
+    void plot(int x, int y)
+    {
+        *out++ = (float)x / 400.0f - 1.0f; // Normalize x
+        *out++ = (float)y / 400.0f - 1.0f; // Normalize y
+    }
+};
+
+// Writes pixel coordinates as int16 pairs, half the size of float pairs.
+// Coordinates must fit in int16; the vertex shader maps them to NDC.
+struct PackedVertexSink
+{
+    int16_t* out;
+
+    void plot(int x, int y)
+    {
+        *out++ = static_cast<int16_t>(x);
+        *out++ = static_cast<int16_t>(y);
+    }
+};
+
+// Sets pixels in an 8-bit framebuffer, skipping any outside it
+struct FramebufferSink
+{
+    uint8_t *pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y)
+    {
+        if (static_cast<unsigned>(x) < static_cast<unsigned>(width) && static_cast<unsigned>(y) < static_cast<unsigned>(height))
+            pixels[static_cast<size_t>(y) * width + x] = value;
+    }
+};
+
+// Collects vertical spans, extending the last span while pixels continue it
+struct SpanSink
+{
+    std::vector<VerticalSpan> &spans;
+
+    void plot(int x, int y)
+    {
+        if (!spans.empty())
+        {
+            VerticalSpan &last = spans.back();
+            if (last.x == x && last.yEnd + 1 == y)
+            {
+                last.yEnd = y;
+                return;
+            }
+        }
+        spans.push_back({ x, y, y });
+    }
+};
+
+// Counts pixels without storing them
+struct CountingSink
+{
+    size_t count = 0;
+
+    void plot(int, int)
+    {
+        ++count;
+    }
+};
+
+// Tracks the bounding box of all plotted pixels; empty while minX > maxX
+struct BoundingBoxSink
+{
+    int minX = INT_MAX;
+    int minY = INT_MAX;
+    int maxX = INT_MIN;
+    int maxY = INT_MIN;
+
+    void plot(int x, int y)
+    {
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+};
+
+// Number of vertices bresenhamLineHigh produces: one per y step
+size_t bresenhamLineHighCount(int y0, int y1)
+{
+    return y1 >= y0 ? static_cast<size_t>(y1 - y0) + 1 : 0;
+}
+
+// Bresenham Line Algorithm for |m| > 1, plotting into any pixel sink
+template <typename Sink>
+void bresenhamLineHighTo(int x0, int y0, int x1, int y1, Sink &sink)
 {
     int dx = x1 - x0;
     int dy = y1 - y0;
@@ -52,8 +164,7 @@ void bresenhamLineHigh(int x0, int y0, int x1, int y1, std::vector<float> &verti
 
     for (int y = y0; y <= y1; ++y)
     {
-        vertices.push_back((float)x / 400.0f - 1.0f); // Normalize x
-        vertices.push_back((float)y / 400.0f - 1.0f); // Normalize y
+        sink.plot(x, y);
         if (D > 0)
         {
             x += xi;
@@ -63,8 +174,530 @@ void bresenhamLineHigh(int x0, int y0, int x1, int y1, std::vector<float> &verti
     }
 }
 
-int main()
+// Bresenham Line Algorithm for |m| > 1, writing into a caller-provided
+// buffer. capacity is in vertices (float pairs) and must be at least
+// bresenhamLineHighCount(); returns the number of vertices written, or 0 if
+// the buffer is too small.
+size_t bresenhamLineHighInto(int x0, int y0, int x1, int y1, float *out, size_t capacity)
+{
+    size_t count = bresenhamLineHighCount(y0, y1);
+    if (capacity < count)
+        return 0;
+
+    VertexSink sink{ out };
+    bresenhamLineHighTo(x0, y0, x1, y1, sink);
+    return count;
+}
+
+void bresenhamLineHigh(int x0, int y0, int x1, int y1, std::vector<float> &vertices)
+{
+    size_t count = bresenhamLineHighCount(y0, y1);
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * count);
+    bresenhamLineHighInto(x0, y0, x1, y1, vertices.data() + base, count);
+}
+
+// Bresenham Line Algorithm for |m| > 1, appending packed int16 pixel coordinates
+void bresenhamLineHighPacked(int x0, int y0, int x1, int y1, std::vector<int16_t> &vertices)
+{
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * bresenhamLineHighCount(y0, y1));
+    PackedVertexSink sink{ vertices.data() + base };
+    bresenhamLineHighTo(x0, y0, x1, y1, sink);
+}
+
+// Double-step, two-ended form of bresenhamLineHigh with identical output.
+// Each iteration classifies the decision variable against three thresholds
+// to place two pixels at once, from the start and from the end. Walking
+// backwards, the pixels bresenhamLineHigh produces on a tie (D == 0) are
+// reproduced by stepping on D >= 0 instead of D > 0.
+void bresenhamLineHighDoubleStep(int x0, int y0, int x1, int y1, std::vector<float> &vertices)
 {
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int xi = 1;
+    if (dx < 0)
+    {
+        xi = -1;
+        dx = -dx;
+    }
+
+    size_t count = bresenhamLineHighCount(y0, y1);
+    if (count == 0)
+        return;
+
+    size_t base = vertices.size();
+    vertices.resize(base + 2 * count);
+    float *out = vertices.data() + base;
+
+    auto plot = [&](int i, int x)
+    {
+        out[2 * i] = (float)x / 400.0f - 1.0f;            // Normalize x
+        out[2 * i + 1] = (float)(y0 + i) / 400.0f - 1.0f; // Normalize y
+    };
+
+    int twoStepFlat = 4 * dx;
+    int twoStepMixed = 4 * dx - 2 * dy;
+    int twoStepDiagonal = 4 * dx - 4 * dy;
+
+    int front = 0, frontX = x0, frontD = 2 * dx - dy;
+    int back = dy, backX = x1, backD = 2 * dx - dy;
+
+    while (back - front >= 3)
+    {
+        plot(front, frontX);
+        plot(back, backX);
+
+        if (frontD <= -2 * dx)
+        {
+            plot(front + 1, frontX);
+            frontD += twoStepFlat;
+        }
+        else if (frontD <= 0)
+        {
+            plot(front + 1, frontX);
+            frontX += xi;
+            frontD += twoStepMixed;
+        }
+        else if (frontD <= 2 * dy - 2 * dx)
+        {
+            frontX += xi;
+            plot(front + 1, frontX);
+            frontD += twoStepMixed;
+        }
+        else
+        {
+            frontX += xi;
+            plot(front + 1, frontX);
+            frontX += xi;
+            frontD += twoStepDiagonal;
+        }
+
+        if (backD < -2 * dx)
+        {
+            plot(back - 1, backX);
+            backD += twoStepFlat;
+        }
+        else if (backD < 0)
+        {
+            plot(back - 1, backX);
+            backX -= xi;
+            backD += twoStepMixed;
+        }
+        else if (backD < 2 * dy - 2 * dx)
+        {
+            backX -= xi;
+            plot(back - 1, backX);
+            backD += twoStepMixed;
+        }
+        else
+        {
+            backX -= xi;
+            plot(back - 1, backX);
+            backX -= xi;
+            backD += twoStepDiagonal;
+        }
+
+        front += 2;
+        back -= 2;
+    }
+
+    // At most three pixels remain between the two walkers
+    for (; front <= back; ++front)
+    {
+        plot(front, frontX);
+        if (frontD > 0)
+        {
+            frontX += xi;
+            frontD -= 2 * dy;
+        }
+        frontD += 2 * dx;
+    }
+}
+
+// Loop state of bresenhamLineHigh at a given step, before that step's pixel
+struct BresenhamHighState
+{
+    int x;
+    int y;
+    int64_t D;
+};
+
+// Closed-form seek into bresenhamLineHigh. After i steps x has moved
+// ceil((2 * dx * i - dy) / (2 * dy)) columns, which fixes D as well.
+BresenhamHighState bresenhamHighSeek(int x0, int y0, int x1, int y1, int64_t i)
+{
+    int64_t dx = x1 - x0;
+    int64_t dy = y1 - y0;
+    int xi = 1;
+    if (dx < 0)
+    {
+        xi = -1;
+        dx = -dx;
+    }
+
+    int64_t columns = dy > 0 ? (2 * dx * i + dy - 1) / (2 * dy) : 0;
+    int64_t D = 2 * dx * (i + 1) - dy - 2 * dy * columns;
+    return { x0 + xi * static_cast<int>(columns), y0 + static_cast<int>(i), D };
+}
+
+// Inclusive pixel rectangle: the viewport or a tile
+struct ClipRect
+{
+    int xMin, yMin;
+    int xMax, yMax;
+};
+
+// First step of bresenhamLineHigh that lands on column k (k columns from x0)
+inline int64_t bresenhamHighColumnStart(int64_t dx, int64_t dy, int64_t k)
+{
+    return k <= 0 ? 0 : (2 * dy * k - dy) / (2 * dx) + 1;
+}
+
+// bresenhamLineHigh clipped to a rectangle. The visible step range is the
+// intersection of the y range and the steps whose column lies inside, found
+// from the closed-form column starts; the loop then seeks to the first
+// visible step. Plots exactly the unclipped pixels that fall inside.
+template <typename Sink>
+void bresenhamLineHighClipped(int x0, int y0, int x1, int y1, const ClipRect &clip, Sink &sink)
+{
+    int64_t dx = static_cast<int64_t>(x1) - x0;
+    int64_t dy = static_cast<int64_t>(y1) - y0;
+    int xi = 1;
+    if (dx < 0)
+    {
+        xi = -1;
+        dx = -dx;
+    }
+
+    // Steps whose y is inside
+    int64_t first = std::max<int64_t>(0, static_cast<int64_t>(clip.yMin) - y0);
+    int64_t last = std::min<int64_t>(dy, static_cast<int64_t>(clip.yMax) - y0);
+
+    // Columns (counted from x0 in the direction of travel) whose x is inside
+    int64_t columnLo = xi > 0 ? static_cast<int64_t>(clip.xMin) - x0 : static_cast<int64_t>(x0) - clip.xMax;
+    int64_t columnHi = xi > 0 ? static_cast<int64_t>(clip.xMax) - x0 : static_cast<int64_t>(x0) - clip.xMin;
+    columnLo = std::max<int64_t>(columnLo, 0);
+    columnHi = std::min<int64_t>(columnHi, dx);
+    if (columnLo > columnHi)
+        return;
+
+    if (dx > 0)
+    {
+        first = std::max(first, bresenhamHighColumnStart(dx, dy, columnLo));
+        if (columnHi < dx)
+            last = std::min(last, bresenhamHighColumnStart(dx, dy, columnHi + 1) - 1);
+    }
+    if (first > last)
+        return;
+
+    BresenhamHighState state = bresenhamHighSeek(x0, y0, x1, y1, first);
+    int x = state.x;
+    int64_t D = state.D;
+    for (int64_t i = first; i <= last; ++i)
+    {
+        sink.plot(x, y0 + static_cast<int>(i));
+        if (D > 0)
+        {
+            x += xi;
+            D -= 2 * dy;
+        }
+        D += 2 * dx;
+    }
+}
+
+// Run-slice form of bresenhamLineHigh: one span per column, same pixels.
+// Column k begins at step floor((2k - 1) * dy / (2 * dx)) + 1, so each run
+// length is dy / dx or one more, and only that choice is decided per run.
+// Like bresenhamLineHigh, emits nothing when y1 < y0.
+void bresenhamSpansHigh(int x0, int y0, int x1, int y1, std::vector<VerticalSpan> &spans)
+{
+    if (y1 < y0)
+        return;
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int xi = 1;
+    if (dx < 0)
+    {
+        xi = -1;
+        dx = -dx;
+    }
+
+    if (dx == 0)
+    {
+        spans.push_back({ x0, y0, y1 });
+        return;
+    }
+
+    spans.reserve(spans.size() + dx + 1);
+
+    int den = 2 * dx;
+    int run = dy / dx;
+    int runError = 2 * dy - run * den;
+
+    int x = x0;
+    int yStart = y0;
+    int nextStart = y0 + dy / den + 1;
+    int error = dy % den;
+
+    for (int k = 0; k < dx; ++k)
+    {
+        spans.push_back({ x, yStart, nextStart - 1 });
+        x += xi;
+        yStart = nextStart;
+        nextStart += run;
+        error += runError;
+        if (error >= den)
+        {
+            ++nextStart;
+            error -= den;
+        }
+    }
+    spans.push_back({ x, yStart, y1 });
+}
+
+// Fills spans into an 8-bit framebuffer; spans must lie inside it
+void fillSpans(const std::vector<VerticalSpan> &spans, uint8_t *framebuffer, int width, uint8_t value)
+{
+    for (const VerticalSpan &span : spans)
+    {
+        uint8_t *pixel = framebuffer + static_cast<size_t>(span.yStart) * width + span.x;
+        for (int y = span.yStart; y <= span.yEnd; ++y, pixel += width)
+            *pixel = value;
+    }
+}
+
+// Integer pixel and segment types used by the batch rasterizer
+struct Pixel
+{
+    int x;
+    int y;
+};
+
+struct Segment
+{
+    int x0, y0;
+    int x1, y1;
+};
+
+// Single-octant Bresenham kernel. The octant is fixed at compile time so the
+// loop carries no direction checks and the y/x step is branch-free.
+template <bool Steep, int Xi, int Yi>
+void bresenhamOctant(const Segment &s, Pixel *out)
+{
+    int dMajor = Steep ? (s.y1 - s.y0) * Yi : (s.x1 - s.x0) * Xi;
+    int dMinor = Steep ? (s.x1 - s.x0) * Xi : (s.y1 - s.y0) * Yi;
+
+    int D = 2 * dMinor - dMajor;
+    int x = s.x0;
+    int y = s.y0;
+
+    for (int i = 0; i <= dMajor; ++i)
+    {
+        out[i] = { x, y };
+        int step = D > 0;
+        D += 2 * dMinor - step * 2 * dMajor;
+        if (Steep)
+        {
+            x += step * Xi;
+            y += Yi;
+        }
+        else
+        {
+            y += step * Yi;
+            x += Xi;
+        }
+    }
+}
+
+// Octant index: bit 2 = steep, bit 1 = x decreasing, bit 0 = y decreasing
+inline int segmentOctant(const Segment &s)
+{
+    int dx = s.x1 - s.x0;
+    int dy = s.y1 - s.y0;
+    int adx = dx < 0 ? -dx : dx;
+    int ady = dy < 0 ? -dy : dy;
+    return ((ady > adx) << 2) | ((dx < 0) << 1) | (dy < 0);
+}
+
+inline size_t segmentPixelCount(const Segment &s)
+{
+    int dx = s.x1 - s.x0;
+    int dy = s.y1 - s.y0;
+    int adx = dx < 0 ? -dx : dx;
+    int ady = dy < 0 ? -dy : dy;
+    return static_cast<size_t>(adx > ady ? adx : ady) + 1;
+}
+
+// Exact number of pixels bresenhamBatch writes for the given segments
+size_t bresenhamBatchCount(const Segment *segments, size_t count)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i)
+        total += segmentPixelCount(segments[i]);
+    return total;
+}
+
+// All-octant batch Bresenham. Every segment is rasterized from (x0, y0) to
+// (x1, y1) into `out`, which must hold bresenhamBatchCount() pixels. Pixels of
+// segment i start at offsets[i]; offsets needs count + 1 entries and its last
+// entry is the total. Segments are bucketed by octant first so each kernel
+// runs over a whole bucket without per-segment dispatch.
+void bresenhamBatch(const Segment *segments, size_t count, Pixel *out, size_t *offsets)
+{
+    using Kernel = void (*)(const Segment &, Pixel *);
+    static const Kernel kernels[8] = {
+        bresenhamOctant<false, 1, 1>,  bresenhamOctant<false, 1, -1>,
+        bresenhamOctant<false, -1, 1>, bresenhamOctant<false, -1, -1>,
+        bresenhamOctant<true, 1, 1>,   bresenhamOctant<true, 1, -1>,
+        bresenhamOctant<true, -1, 1>,  bresenhamOctant<true, -1, -1>,
+    };
+
+    // Output offsets in input order, and a counting sort of segment indices by octant
+    std::vector<uint32_t> order(count);
+    std::vector<uint8_t> octants(count);
+    size_t bucketStart[9] = {};
+
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        octants[i] = static_cast<uint8_t>(segmentOctant(segments[i]));
+        ++bucketStart[octants[i] + 1];
+        offsets[i + 1] = offsets[i] + segmentPixelCount(segments[i]);
+    }
+    for (int o = 0; o < 8; ++o)
+        bucketStart[o + 1] += bucketStart[o];
+
+    size_t fill[8];
+    for (int o = 0; o < 8; ++o)
+        fill[o] = bucketStart[o];
+    for (size_t i = 0; i < count; ++i)
+        order[fill[octants[i]]++] = static_cast<uint32_t>(i);
+
+    for (int o = 0; o < 8; ++o)
+    {
+        Kernel kernel = kernels[o];
+        for (size_t k = bucketStart[o]; k < bucketStart[o + 1]; ++k)
+        {
+            uint32_t i = order[k];
+            kernel(segments[i], out + offsets[i]);
+        }
+    }
+}
+
+// Convenience wrapper returning one contiguous pixel stream for all segments
+std::vector<Pixel> bresenhamBatch(const std::vector<Segment> &segments, std::vector<size_t> &offsets)
+{
+    std::vector<Pixel> pixels(bresenhamBatchCount(segments.data(), segments.size()));
+    offsets.resize(segments.size() + 1);
+    bresenhamBatch(segments.data(), segments.size(), pixels.data(), offsets.data());
+    return pixels;
+}
+
+// Checks bresenhamLineHighDoubleStep against bresenhamLineHigh, vertex for
+// vertex, over every line with |dx| <= dy up to 300 pixels long from a few
+// start points, plus reversed endpoints. Prints the result and returns
+// whether every line matched.
+bool verifyDoubleStep()
+{
+    const int starts[3][2] = { { 0, 0 }, { -7, 3 }, { 120, -250 } };
+    size_t lines = 0, mismatches = 0;
+    std::vector<float> expected, actual;
+    for (const auto &start : starts)
+    {
+        for (int dy = -3; dy <= 300; ++dy)
+        {
+            int maxDx = std::max(dy, 3);
+            for (int dx = -maxDx; dx <= maxDx; ++dx)
+            {
+                expected.clear();
+                actual.clear();
+                bresenhamLineHigh(start[0], start[1], start[0] + dx, start[1] + dy, expected);
+                bresenhamLineHighDoubleStep(start[0], start[1], start[0] + dx, start[1] + dy, actual);
+                ++lines;
+                if (expected != actual)
+                    ++mismatches;
+            }
+        }
+    }
+    std::cout << "double-step: " << lines << " lines, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// Checks bresenhamBatch against bresenhamLineHigh in every octant. Each
+// segment's reference is bresenhamLineHighTo run on coordinates mirrored and,
+// for shallow segments, transposed into the |m| > 1, y-increasing octant, then
+// mapped back. All segments up to 48 pixels from a few start points go
+// through one batch call, so the octant bucketing and offsets are covered too.
+bool verifyBatch()
+{
+    // Maps reference pixels back out of the canonical octant
+    struct OctantSink
+    {
+        std::vector<Pixel> &pixels;
+        bool transposed;
+        int xi;
+        int yi;
+
+        void plot(int u, int v)
+        {
+            Pixel p = transposed ? Pixel{ v, u } : Pixel{ u, v };
+            pixels.push_back({ p.x * xi, p.y * yi });
+        }
+    };
+
+    const int starts[3][2] = { { 0, 0 }, { -7, 3 }, { 120, -250 } };
+    std::vector<Segment> segments;
+    for (const auto &start : starts)
+        for (int dy = -48; dy <= 48; ++dy)
+            for (int dx = -48; dx <= 48; ++dx)
+                segments.push_back({ start[0], start[1], start[0] + dx, start[1] + dy });
+
+    std::vector<size_t> offsets;
+    std::vector<Pixel> pixels = bresenhamBatch(segments, offsets);
+
+    size_t mismatches = 0;
+    std::vector<Pixel> expected;
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        const Segment &s = segments[i];
+        int xi = s.x1 >= s.x0 ? 1 : -1;
+        int yi = s.y1 >= s.y0 ? 1 : -1;
+        bool steep = (s.y1 - s.y0) * yi > (s.x1 - s.x0) * xi;
+
+        expected.clear();
+        if (steep)
+        {
+            OctantSink sink{ expected, false, 1, yi };
+            bresenhamLineHighTo(s.x0, s.y0 * yi, s.x1, s.y1 * yi, sink);
+        }
+        else
+        {
+            OctantSink sink{ expected, true, xi, 1 };
+            bresenhamLineHighTo(s.y0, s.x0 * xi, s.y1, s.x1 * xi, sink);
+        }
+
+        bool match = expected.size() == offsets[i + 1] - offsets[i];
+        for (size_t k = 0; match && k < expected.size(); ++k)
+            match = expected[k].x == pixels[offsets[i] + k].x && expected[k].y == pixels[offsets[i] + k].y;
+        if (!match)
+            ++mismatches;
+    }
+    std::cout << "batch: " << segments.size() << " segments, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv)
+{
+    // Headless equivalence checks of the double-step and batch rasterizers
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0)
+    {
+        bool ok = verifyDoubleStep();
+        ok = verifyBatch() && ok;
+        return ok ? 0 : 1;
+    }
+
     // Initialize window
     GLFWwindow *window = initializeWindow(800, 800, "Bresenham Line |m| < 1");
     if (!window)
@@ -73,8 +706,10 @@ int main()
     // Shader sources
     const char *vertexShaderSource = "#version 330 core\n"
                                      "layout (location = 0) in vec2 aPos;\n"
+                                     "uniform vec2 uScale;\n"
+                                     "uniform vec2 uOffset;\n"
                                      "void main() {\n"
-                                     "   gl_Position = vec4(aPos, 0.0, 1.0);\n"
+                                     "   gl_Position = vec4(aPos * uScale + uOffset, 0.0, 1.0);\n"
                                      "}\n";
     const char *fragmentShaderSource = "#version 330 core\n"
                                        "out vec4 FragColor;\n"
@@ -99,9 +734,18 @@ int main()
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    // Packed int16 pixel coordinates halve the vertex buffer and leave the
+    // pixel-to-NDC transform to the vertex shader
+    const bool usePackedVertices = true;
+
     // coordinnates
     std::vector<float> lineVertices;
-    bresenhamLineHigh(200, 100, 400, 700, lineVertices); // Example line for steep slope
+    std::vector<int16_t> packedVertices;
+    if (usePackedVertices)
+        bresenhamLineHighPacked(200, 100, 400, 700, packedVertices); // Example line for steep slope
+    else
+        bresenhamLineHigh(200, 100, 400, 700, lineVertices); // Example line for steep slope
+    GLsizei vertexCount = static_cast<GLsizei>(usePackedVertices ? packedVertices.size() / 2 : lineVertices.size() / 2);
 
     // Create VAO and VBO
     GLuint VAO, VBO;
@@ -110,12 +754,33 @@ int main()
 
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    if (usePackedVertices)
+    {
+        glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(int16_t), packedVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 2 * sizeof(int16_t), (void *)0);
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    }
     glEnableVertexAttribArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // Pixel coordinates map to NDC as x / 400 - 1; float vertices are already normalized
+    glUseProgram(shaderProgram);
+    if (usePackedVertices)
+    {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f / 400.0f, 1.0f / 400.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), -1.0f, -1.0f);
+    }
+    else
+    {
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f, 1.0f);
+        glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), 0.0f, 0.0f);
+    }
+
     // Render loop
     while (!glfwWindowShouldClose(window))
     {
@@ -125,7 +790,7 @@ int main()
         // Draw lines
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO);
-        glDrawArrays(GL_LINE_STRIP, 0, lineVertices.size() / 2);
+        glDrawArrays(GL_LINE_STRIP, 0, vertexCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
@@ -2,12 +2,29 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define DDA_SIMD_X86 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DDA_SIMD_NEON 1
+#endif
 
 const char *vertexShaderSource = R"glsl(
     #version 330 core
     layout (location = 0) in vec2 aPos;
+    uniform vec2 uScale;
+    uniform vec2 uOffset;
     void main() {
-        gl_Position = vec4(aPos, 0.0, 1.0);
+        gl_Position = vec4(aPos * uScale + uOffset, 0.0, 1.0);
     }
 )glsl";
 
@@ -19,10 +36,21 @@ const char *fragmentShaderSource = R"glsl(
     }
 )glsl";
 
-// DDA Algorithm
-std::vector<float> generateLineVertices(float x1, float y1, float x2, float y2)
+// Number of (x, y) samples generateLineVertices produces for these endpoints
+int ddaSampleCount(float x1, float y1, float x2, float y2)
 {
-    std::vector<float> vertices;
+    float steps = std::max(std::abs(x2 - x1), std::abs(y2 - y1));
+    return static_cast<int>(steps) + 1;
+}
+
+// DDA Algorithm, writing into a caller-provided buffer. capacity is in
+// vertices (float pairs) and must be at least ddaSampleCount(); returns the
+// number of vertices written, or 0 if the buffer is too small.
+size_t generateLineVerticesInto(float x1, float y1, float x2, float y2, float *out, size_t capacity)
+{
+    int count = ddaSampleCount(x1, y1, x2, y2);
+    if (capacity < static_cast<size_t>(count))
+        return 0;
 
     float dx = x2 - x1;
     float dy = y2 - y1;
@@ -34,19 +62,1192 @@ std::vector<float> generateLineVertices(float x1, float y1, float x2, float y2)
     float x = x1;
     float y = y1;
 
-    for (int i = 0; i <= steps; ++i)
+    for (int i = 0; i < count; ++i)
     {
-        vertices.push_back(x);
-        vertices.push_back(y);
+        out[2 * i] = x;
+        out[2 * i + 1] = y;
         x += xInc;
         y += yInc;
     }
 
+    return count;
+}
+
+// DDA Algorithm
+std::vector<float> generateLineVertices(float x1, float y1, float x2, float y2)
+{
+    std::vector<float> vertices(2 * static_cast<size_t>(ddaSampleCount(x1, y1, x2, y2)));
+    generateLineVerticesInto(x1, y1, x2, y2, vertices.data(), vertices.size() / 2);
+    return vertices;
+}
+
+// DDA kernels: sample i is (x1 + i * xInc, y1 + i * yInc), written interleaved
+// into out[0 .. 2 * count). Every kernel evaluates the same expression in the
+// same order, so all of them produce identical output.
+using DdaKernel = void (*)(float x1, float y1, float xInc, float yInc, int count, float *out);
+
+void ddaKernelScalar(float x1, float y1, float xInc, float yInc, int count, float *out)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        out[2 * i] = static_cast<float>(i) * xInc + x1;
+        out[2 * i + 1] = static_cast<float>(i) * yInc + y1;
+    }
+}
+
+#if DDA_SIMD_X86
+// 4 samples per step, SSE2 is always available on x86-64
+void ddaKernelSse(float x1, float y1, float xInc, float yInc, int count, float *out)
+{
+    const __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 vx1 = _mm_set1_ps(x1), vy1 = _mm_set1_ps(y1);
+    const __m128 vxInc = _mm_set1_ps(xInc), vyInc = _mm_set1_ps(yInc);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 fi = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lane);
+        __m128 xs = _mm_add_ps(_mm_mul_ps(fi, vxInc), vx1);
+        __m128 ys = _mm_add_ps(_mm_mul_ps(fi, vyInc), vy1);
+        _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(xs, ys));
+        _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(xs, ys));
+    }
+    for (; i < count; ++i)
+    {
+        out[2 * i] = static_cast<float>(i) * xInc + x1;
+        out[2 * i + 1] = static_cast<float>(i) * yInc + y1;
+    }
+}
+
+// 8 samples per step. Only AVX float ops are needed, so the check is for AVX.
+__attribute__((target("avx"))) void ddaKernelAvx(float x1, float y1, float xInc, float yInc, int count, float *out)
+{
+    const __m256 lane = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    const __m256 vx1 = _mm256_set1_ps(x1), vy1 = _mm256_set1_ps(y1);
+    const __m256 vxInc = _mm256_set1_ps(xInc), vyInc = _mm256_set1_ps(yInc);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 fi = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), lane);
+        __m256 xs = _mm256_add_ps(_mm256_mul_ps(fi, vxInc), vx1);
+        __m256 ys = _mm256_add_ps(_mm256_mul_ps(fi, vyInc), vy1);
+
+        // unpack interleaves within 128-bit lanes, permute puts the lanes back in order
+        __m256 lo = _mm256_unpacklo_ps(xs, ys);
+        __m256 hi = _mm256_unpackhi_ps(xs, ys);
+        _mm256_storeu_ps(out + 2 * i, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(out + 2 * i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    for (; i < count; ++i)
+    {
+        out[2 * i] = static_cast<float>(i) * xInc + x1;
+        out[2 * i + 1] = static_cast<float>(i) * yInc + y1;
+    }
+}
+#endif
+
+#if DDA_SIMD_NEON
+// 4 samples per step, vst2q interleaves x and y on store
+void ddaKernelNeon(float x1, float y1, float xInc, float yInc, int count, float *out)
+{
+    const float laneInit[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+    const float32x4_t lane = vld1q_f32(laneInit);
+    const float32x4_t vx1 = vdupq_n_f32(x1), vy1 = vdupq_n_f32(y1);
+    const float32x4_t vxInc = vdupq_n_f32(xInc), vyInc = vdupq_n_f32(yInc);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t fi = vaddq_f32(vdupq_n_f32(static_cast<float>(i)), lane);
+        float32x4x2_t xy;
+        xy.val[0] = vaddq_f32(vmulq_f32(fi, vxInc), vx1);
+        xy.val[1] = vaddq_f32(vmulq_f32(fi, vyInc), vy1);
+        vst2q_f32(out + 2 * i, xy);
+    }
+    for (; i < count; ++i)
+    {
+        out[2 * i] = static_cast<float>(i) * xInc + x1;
+        out[2 * i + 1] = static_cast<float>(i) * yInc + y1;
+    }
+}
+#endif
+
+// Picks the widest kernel the running CPU supports
+DdaKernel selectDdaKernel()
+{
+#if DDA_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx"))
+        return ddaKernelAvx;
+    return ddaKernelSse;
+#elif DDA_SIMD_NEON
+    return ddaKernelNeon;
+#else
+    return ddaKernelScalar;
+#endif
+}
+
+// Vectorized DDA over the same steps as generateLineVertices, but each
+// sample is computed directly from its index instead of through a running
+// sum, so several are produced per step and written straight into a
+// pre-sized buffer. Samples can differ from generateLineVertices by the
+// float drift of its running sum, which reaches about a pixel on lines
+// tens of thousands of pixels long.
+std::vector<float> generateLineVerticesSimd(float x1, float y1, float x2, float y2)
+{
+    static const DdaKernel kernel = selectDdaKernel();
+
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float steps = std::max(std::abs(dx), std::abs(dy));
+    int count = ddaSampleCount(x1, y1, x2, y2);
+
+    // A zero-length line is a single sample; avoid 0 / 0 increments
+    float xInc = steps > 0.0f ? dx / steps : 0.0f;
+    float yInc = steps > 0.0f ? dy / steps : 0.0f;
+
+    std::vector<float> vertices(2 * static_cast<size_t>(count));
+    kernel(x1, y1, xInc, yInc, count, vertices.data());
+    return vertices;
+}
+
+// Integer pixel produced by the pixel-space DDA modes
+struct Pixel
+{
+    int x;
+    int y;
+};
+
+// Horizontal run of pixels on row y, inclusive on both ends
+struct HorizontalSpan
+{
+    int y;
+    int xStart;
+    int xEnd;
+};
+
+// Pixel sinks. The rasterizers are templates over a Sink with
+// plot(int x, int y), so the destination is inlined into the pixel loop.
+
+// Writes normalized (x, y) vertex pairs for the 800x800 window
+struct VertexSink
+{
+    float *out;
+
+    void plot(int x, int y)
+    {
+        *out++ = (float)x / 400.0f - 1.0f; // Normalize x
+        *out++ = (float)y / 400.0f - 1.0f; // Normalize y
+    }
+};
+
+// Writes Pixel structs
+struct PixelSink
+{
+    Pixel *out;
+
+    void plot(int x, int y)
+    {
+        *out++ = {x, y};
+    }
+};
+
+// Writes pixel coordinates as int16 pairs, half the size of float pairs.
+// Coordinates must fit in int16; a vertex shader maps them to NDC.
+struct PackedVertexSink
+{
+    int16_t *out;
+
+    void plot(int x, int y)
+    {
+        *out++ = static_cast<int16_t>(x);
+        *out++ = static_cast<int16_t>(y);
+    }
+};
+
+// Sets pixels in an 8-bit framebuffer, skipping any outside it
+struct FramebufferSink
+{
+    uint8_t *pixels;
+    int width;
+    int height;
+    uint8_t value;
+
+    void plot(int x, int y)
+    {
+        if (static_cast<unsigned>(x) < static_cast<unsigned>(width) && static_cast<unsigned>(y) < static_cast<unsigned>(height))
+            pixels[static_cast<size_t>(y) * width + x] = value;
+    }
+};
+
+// Collects horizontal spans, extending the last span while pixels continue it
+struct SpanSink
+{
+    std::vector<HorizontalSpan> &spans;
+
+    void plot(int x, int y)
+    {
+        if (!spans.empty())
+        {
+            HorizontalSpan &last = spans.back();
+            if (last.y == y && last.xEnd + 1 == x)
+            {
+                last.xEnd = x;
+                return;
+            }
+        }
+        spans.push_back({y, x, x});
+    }
+};
+
+// Counts pixels without storing them
+struct CountingSink
+{
+    size_t count = 0;
+
+    void plot(int, int)
+    {
+        ++count;
+    }
+};
+
+// Tracks the bounding box of all plotted pixels; empty while minX > maxX
+struct BoundingBoxSink
+{
+    int minX = INT_MAX;
+    int minY = INT_MAX;
+    int maxX = INT_MIN;
+    int maxY = INT_MIN;
+
+    void plot(int x, int y)
+    {
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+};
+
+// Float accumulates xInc/yInc like generateLineVertices. Fixed steps in 16.16
+// or 32.32 fixed point and always lands exactly on both endpoints.
+enum class DdaMode
+{
+    Float,
+    Fixed
+};
+
+// num / den rounded to nearest, halves away from zero; den must be positive
+inline int64_t roundedDiv(int64_t num, int64_t den)
+{
+    return num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den);
+}
+
+// Floor and ceiling of num / den; den must be positive
+template <typename T>
+inline T floorDiv(T num, T den)
+{
+    return num >= 0 ? num / den : -((-num + den - 1) / den);
+}
+
+template <typename T>
+inline T ceilDiv(T num, T den)
+{
+    return -floorDiv(-num, den);
+}
+
+// One axis of a fixed-point DDA: the position after i steps is
+// (start + i * inc) >> shift. start sits on the pixel centre so the shift
+// rounds instead of truncating, and inc is rounded to the nearest unit.
+struct DdaFixedAxis
+{
+    int64_t start;
+    int64_t inc;
+};
+
+inline DdaFixedAxis ddaFixedAxis(int64_t origin, int64_t delta, int64_t steps, int shift)
+{
+    int64_t one = int64_t(1) << shift;
+    return {origin * one + one / 2, steps > 0 ? roundedDiv(delta * one, steps) : 0};
+}
+
+// Pixel-space DDA with a float accumulator. Steps before `first` are
+// accumulated but not plotted.
+template <typename Sink>
+void ddaLineFloat(int x0, int y0, int x1, int y1, Sink &sink, int64_t first = 0)
+{
+    int64_t dx = static_cast<int64_t>(x1) - x0;
+    int64_t dy = static_cast<int64_t>(y1) - y0;
+    int64_t steps = std::max(std::abs(dx), std::abs(dy));
+
+    float xInc = steps > 0 ? static_cast<float>(dx) / steps : 0.0f;
+    float yInc = steps > 0 ? static_cast<float>(dy) / steps : 0.0f;
+
+    float x = static_cast<float>(x0);
+    float y = static_cast<float>(y0);
+
+    for (int64_t i = 0; i <= steps; ++i)
+    {
+        if (i >= first)
+            sink.plot(static_cast<int>(std::lround(x)), static_cast<int>(std::lround(y)));
+        x += xInc;
+        y += yInc;
+    }
+}
+
+// 16.16 DDA for coordinates within +-32767. The increment is rounded to the
+// nearest 1/65536, so after at most 65534 steps the accumulated error stays
+// below half a pixel and the last sample rounds to exactly (x1, y1).
+// Positions are evaluated as start + i * inc in wrapping 32-bit arithmetic,
+// which keeps the loop free of carried state so it vectorizes. Only steps
+// first..last are plotted, which is how clipping skips invisible pixels.
+template <typename Sink>
+void ddaLineFixed16(int x0, int y0, int x1, int y1, Sink &sink, int64_t first = 0, int64_t last = INT64_MAX)
+{
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int steps = std::max(std::abs(dx), std::abs(dy));
+
+    DdaFixedAxis xAxis = ddaFixedAxis(x0, dx, steps, 16);
+    DdaFixedAxis yAxis = ddaFixedAxis(y0, dy, steps, 16);
+    uint32_t xStart = static_cast<uint32_t>(xAxis.start), xInc = static_cast<uint32_t>(xAxis.inc);
+    uint32_t yStart = static_cast<uint32_t>(yAxis.start), yInc = static_cast<uint32_t>(yAxis.inc);
+
+    int end = static_cast<int>(std::min<int64_t>(last, steps));
+    for (int i = static_cast<int>(std::max<int64_t>(first, 0)); i <= end; ++i)
+    {
+        uint32_t fi = static_cast<uint32_t>(i);
+        sink.plot(static_cast<int32_t>(xStart + fi * xInc) >> 16, static_cast<int32_t>(yStart + fi * yInc) >> 16);
+    }
+}
+
+// Whether every coordinate fits the 32.32 DDA. The bound is exclusive: a
+// delta of 2^31 shifted by 32 is already 2^63, one past int64.
+inline bool ddaFitsFixed32(int x0, int y0, int x1, int y1)
+{
+    const int fixed32Limit = 1 << 30;
+    auto fits = [&](int v) { return v > -fixed32Limit && v < fixed32Limit; };
+    return fits(x0) && fits(y0) && fits(x1) && fits(y1);
+}
+
+// 32.32 DDA for coordinates strictly within +-2^30, same scheme as ddaLineFixed16 in
+// 64-bit lanes; exact endpoints for any line in that range. Lines reaching
+// further out are evaluated per step in double precision instead, which
+// still lands on both endpoints.
+template <typename Sink>
+void ddaLineFixed32(int x0, int y0, int x1, int y1, Sink &sink, int64_t first = 0, int64_t last = INT64_MAX)
+{
+    int64_t dx = static_cast<int64_t>(x1) - x0;
+    int64_t dy = static_cast<int64_t>(y1) - y0;
+    int64_t steps = std::max(std::abs(dx), std::abs(dy));
+
+    if (!ddaFitsFixed32(x0, y0, x1, y1))
+    {
+        double xInc = steps > 0 ? static_cast<double>(dx) / steps : 0.0;
+        double yInc = steps > 0 ? static_cast<double>(dy) / steps : 0.0;
+        int64_t end = std::min(last, steps);
+        for (int64_t i = std::max<int64_t>(first, 0); i <= end; ++i)
+            sink.plot(static_cast<int>(std::floor(x0 + static_cast<double>(i) * xInc + 0.5)),
+                      static_cast<int>(std::floor(y0 + static_cast<double>(i) * yInc + 0.5)));
+        return;
+    }
+
+    DdaFixedAxis xAxis = ddaFixedAxis(x0, dx, steps, 32);
+    DdaFixedAxis yAxis = ddaFixedAxis(y0, dy, steps, 32);
+    uint64_t xStart = static_cast<uint64_t>(xAxis.start), xInc = static_cast<uint64_t>(xAxis.inc);
+    uint64_t yStart = static_cast<uint64_t>(yAxis.start), yInc = static_cast<uint64_t>(yAxis.inc);
+
+    int64_t end = std::min(last, steps);
+    for (int64_t i = std::max<int64_t>(first, 0); i <= end; ++i)
+    {
+        uint64_t fi = static_cast<uint64_t>(i);
+        sink.plot(static_cast<int>(static_cast<int64_t>(xStart + fi * xInc) >> 32),
+                  static_cast<int>(static_cast<int64_t>(yStart + fi * yInc) >> 32));
+    }
+}
+
+// Number of pixels a pixel-space DDA writes for these endpoints
+size_t ddaPixelCount(int x0, int y0, int x1, int y1)
+{
+    int64_t dx = std::abs(static_cast<int64_t>(x1) - x0);
+    int64_t dy = std::abs(static_cast<int64_t>(y1) - y0);
+    return static_cast<size_t>(std::max(dx, dy)) + 1;
+}
+
+// Whether every coordinate fits the 16.16 DDA
+inline bool ddaFitsFixed16(int x0, int y0, int x1, int y1)
+{
+    const int fixed16Limit = 32767;
+    return std::abs(x0) <= fixed16Limit && std::abs(y0) <= fixed16Limit &&
+           std::abs(x1) <= fixed16Limit && std::abs(y1) <= fixed16Limit;
+}
+
+// Pixel-space DDA into any pixel sink. Fixed mode uses 16.16 when every
+// coordinate fits and falls back to 32.32 otherwise.
+template <typename Sink>
+void ddaLine(int x0, int y0, int x1, int y1, Sink &sink, DdaMode mode = DdaMode::Fixed)
+{
+    if (mode == DdaMode::Float)
+    {
+        ddaLineFloat(x0, y0, x1, y1, sink);
+        return;
+    }
+
+    if (ddaFitsFixed16(x0, y0, x1, y1))
+        ddaLineFixed16(x0, y0, x1, y1, sink);
+    else
+        ddaLineFixed32(x0, y0, x1, y1, sink);
+}
+
+// Pixel-space DDA returning the pixels
+std::vector<Pixel> generateLinePixels(int x0, int y0, int x1, int y1, DdaMode mode = DdaMode::Fixed)
+{
+    std::vector<Pixel> pixels(ddaPixelCount(x0, y0, x1, y1));
+    PixelSink sink{pixels.data()};
+    ddaLine(x0, y0, x1, y1, sink, mode);
+    return pixels;
+}
+
+// Pixel-space DDA returning int16 (x, y) pairs for a GL_SHORT vertex buffer
+std::vector<int16_t> generateLinePackedVertices(int x0, int y0, int x1, int y1, DdaMode mode = DdaMode::Fixed)
+{
+    std::vector<int16_t> vertices(2 * ddaPixelCount(x0, y0, x1, y1));
+    PackedVertexSink sink{vertices.data()};
+    ddaLine(x0, y0, x1, y1, sink, mode);
+    return vertices;
+}
+
+// Dash pattern as alternating on/off run lengths in pixels, starting with an
+// on run; runs needs an even count. phase is the position within the pattern
+// and advances by every step rasterized, so passing the same pattern to the
+// segments of a polyline continues the dashes across the joints.
+struct DashPattern
+{
+    std::vector<int> runs;
+    int64_t phase = 0;
+};
+
+// Dash pattern repeating a 32-pixel bitmask, bit 0 first
+DashPattern dashPatternFromMask(uint32_t mask)
+{
+    DashPattern dash;
+    int bit = 0;
+    while (bit < 32)
+    {
+        bool on = dash.runs.size() % 2 == 0;
+        int run = 0;
+        while (bit < 32 && (((mask >> bit) & 1u) != 0) == on)
+        {
+            ++run;
+            ++bit;
+        }
+        dash.runs.push_back(run);
+    }
+    if (dash.runs.size() % 2 != 0)
+        dash.runs.push_back(0);
+    return dash;
+}
+
+// Calls onRun(first, last) for every on run covering steps [begin, count),
+// jumping whole off runs without visiting their steps, then advances the
+// phase past the steps covered. A pattern with no length is solid.
+template <typename RunFn>
+void forEachDashRun(DashPattern &dash, int64_t begin, int64_t count, RunFn onRun)
+{
+    int64_t period = 0;
+    for (int run : dash.runs)
+        period += run;
+    if (begin >= count)
+        return;
+    if (period == 0)
+    {
+        onRun(begin, count - 1);
+        return;
+    }
+
+    // Locate the run containing the current phase
+    int64_t offset = dash.phase % period;
+    size_t run = 0;
+    while (offset >= dash.runs[run])
+    {
+        offset -= dash.runs[run];
+        ++run;
+    }
+    int64_t remaining = dash.runs[run] - offset;
+
+    for (int64_t i = begin; i < count;)
+    {
+        int64_t len = std::min(remaining, count - i);
+        if (run % 2 == 0 && len > 0)
+            onRun(i, i + len - 1);
+        i += len;
+        run = (run + 1) % dash.runs.size();
+        remaining = dash.runs[run];
+    }
+    dash.phase = (dash.phase + count - begin) % period;
+}
+
+// Dashed pixel-space DDA. Each on run is plotted through the first..last
+// step range of the fixed-point DDA, so off runs are skipped in O(1) and the
+// pixels plotted are exactly those of the solid fixed-mode line. Steps before
+// `begin` are neither plotted nor counted against the pattern.
+template <typename Sink>
+void ddaLineDashed(int x0, int y0, int x1, int y1, DashPattern &dash, Sink &sink, int64_t begin = 0)
+{
+    bool fixed16 = ddaFitsFixed16(x0, y0, x1, y1);
+    auto plotRun = [&](int64_t first, int64_t last)
+    {
+        if (fixed16)
+            ddaLineFixed16(x0, y0, x1, y1, sink, first, last);
+        else
+            ddaLineFixed32(x0, y0, x1, y1, sink, first, last);
+    };
+    forEachDashRun(dash, begin, static_cast<int64_t>(ddaPixelCount(x0, y0, x1, y1)), plotRun);
+}
+
+// Dashed generateLineVertices. Samples are evaluated in the index form
+// i * inc + start of generateLineVerticesSimd, so an on run starts at any
+// sample without stepping through the off run before it.
+std::vector<float> generateLineVerticesDashed(float x1, float y1, float x2, float y2, DashPattern &dash)
+{
+    std::vector<float> vertices;
+
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float steps = std::max(std::abs(dx), std::abs(dy));
+    float xInc = steps > 0.0f ? dx / steps : 0.0f;
+    float yInc = steps > 0.0f ? dy / steps : 0.0f;
+
+    auto emitRun = [&](int64_t first, int64_t last)
+    {
+        for (int64_t i = first; i <= last; ++i)
+        {
+            vertices.push_back(static_cast<float>(i) * xInc + x1);
+            vertices.push_back(static_cast<float>(i) * yInc + y1);
+        }
+    };
+    forEachDashRun(dash, 0, ddaSampleCount(x1, y1, x2, y2), emitRun);
+    return vertices;
+}
+
+// Hands pixels to a callback in chunks of at most `capacity`, staging them in
+// a caller-provided buffer so memory stays bounded however long the input is
+template <typename ChunkFn>
+struct ChunkedPixelSink
+{
+    Pixel *buffer;
+    size_t capacity;
+    ChunkFn &onChunk;
+    size_t count = 0;
+    size_t total = 0;
+
+    void plot(int x, int y)
+    {
+        buffer[count++] = {x, y};
+        if (count == capacity)
+            flush();
+    }
+
+    void flush()
+    {
+        if (count == 0)
+            return;
+        onChunk(static_cast<const Pixel *>(buffer), count);
+        total += count;
+        count = 0;
+    }
+};
+
+// Streaming polyline DDA. Points come from any input iterator over values
+// with int x and y members; each segment starts at step 1 so the joint it
+// shares with the previous segment is plotted once, and repeated points add
+// nothing. Pixels are staged in buffer and passed to
+// onChunk(const Pixel *pixels, size_t count) whenever capacity of them are
+// ready, plus once more at the end for the remainder. Returns the number of
+// pixels emitted. With a dash pattern the segments are drawn by
+// ddaLineDashed, whose phase runs on across the joints, and mode is ignored.
+template <typename PointIt, typename ChunkFn>
+size_t ddaPolyline(PointIt first, PointIt last, Pixel *buffer, size_t capacity, ChunkFn onChunk,
+                   DdaMode mode = DdaMode::Fixed, DashPattern *dash = nullptr)
+{
+    ChunkedPixelSink<ChunkFn> sink{buffer, capacity, onChunk};
+    if (first == last || capacity == 0)
+        return 0;
+
+    int x0 = first->x;
+    int y0 = first->y;
+    if (dash)
+        ddaLineDashed(x0, y0, x0, y0, *dash, sink);
+    else
+        sink.plot(x0, y0);
+
+    for (++first; first != last; ++first)
+    {
+        int x1 = first->x;
+        int y1 = first->y;
+        if (dash)
+            ddaLineDashed(x0, y0, x1, y1, *dash, sink, 1);
+        else if (mode == DdaMode::Float)
+            ddaLineFloat(x0, y0, x1, y1, sink, 1);
+        else if (ddaFitsFixed16(x0, y0, x1, y1))
+            ddaLineFixed16(x0, y0, x1, y1, sink, 1);
+        else
+            ddaLineFixed32(x0, y0, x1, y1, sink, 1);
+        x0 = x1;
+        y0 = y1;
+    }
+
+    sink.flush();
+    return sink.total;
+}
+
+// Polyline DDA returning all pixels; ddaPolyline streams them instead
+std::vector<Pixel> generatePolylinePixels(const std::vector<Pixel> &points, DdaMode mode = DdaMode::Fixed)
+{
+    std::vector<Pixel> pixels;
+    Pixel chunk[1024];
+    ddaPolyline(points.begin(), points.end(), chunk, 1024, [&](const Pixel *p, size_t count)
+                { pixels.insert(pixels.end(), p, p + count); },
+                mode);
+    return pixels;
+}
+
+// Inclusive pixel rectangle: the viewport or a tile
+struct ClipRect
+{
+    int xMin, yMin;
+    int xMax, yMax;
+};
+
+// Forwards only pixels inside the rectangle
+template <typename Sink>
+struct ClippedSink
+{
+    ClipRect clip;
+    Sink &sink;
+
+    void plot(int x, int y)
+    {
+        if (x >= clip.xMin && x <= clip.xMax && y >= clip.yMin && y <= clip.yMax)
+            sink.plot(x, y);
+    }
+};
+
+// Narrows [first, last] to the steps whose position on this axis lands in
+// [lo, hi]. The position is monotonic in i, so the bounds are two divisions.
+// In 32.32 a clip bound far from the line's start is up to 2^63 away, so the
+// edges and quotients are 128-bit and only come back to 64 bits clamped.
+inline void ddaFixedClip(const DdaFixedAxis &axis, int shift, int lo, int hi, int64_t &first, int64_t &last)
+{
+    __int128 one = __int128(1) << shift;
+    __int128 loEdge = lo * one - axis.start;
+    __int128 hiEdge = (__int128(hi) + 1) * one - 1 - axis.start;
+    __int128 inc = axis.inc;
+    auto narrow = [](__int128 v) { return static_cast<int64_t>(std::max<__int128>(std::min<__int128>(v, INT64_MAX), INT64_MIN)); };
+
+    if (inc > 0)
+    {
+        first = std::max(first, narrow(ceilDiv(loEdge, inc)));
+        last = std::min(last, narrow(floorDiv(hiEdge, inc)));
+    }
+    else if (inc < 0)
+    {
+        first = std::max(first, narrow(ceilDiv(-hiEdge, -inc)));
+        last = std::min(last, narrow(floorDiv(-loEdge, -inc)));
+    }
+    else if (loEdge > 0 || hiEdge < 0)
+    {
+        last = first - 1;
+    }
+}
+
+// Narrows [first, last] to the steps whose double-precision position
+// origin + i * inc can round into [lo, hi]. The bounds carry a pixel of
+// slack, far more than the rounding error of the positions, and the caller
+// still tests each pixel. Quotients are clamped in double before conversion
+// since a shallow axis can put them past 2^63.
+inline void ddaDoubleClip(int origin, double inc, int lo, int hi, int64_t &first, int64_t &last)
+{
+    double low = static_cast<double>(first) - 1.0, high = static_cast<double>(last) + 1.0;
+    auto step = [&](double v) { return static_cast<int64_t>(std::max(low, std::min(high, v))); };
+
+    if (inc > 0.0)
+    {
+        first = std::max(first, step(std::floor((lo - 1.5 - origin) / inc)));
+        last = std::min(last, step(std::ceil((hi + 1.5 - origin) / inc)));
+    }
+    else if (inc < 0.0)
+    {
+        first = std::max(first, step(std::floor((hi + 1.5 - origin) / inc)));
+        last = std::min(last, step(std::ceil((lo - 1.5 - origin) / inc)));
+    }
+    else if (origin < lo || origin > hi)
+    {
+        last = first - 1;
+    }
+}
+
+// Pixel-space DDA clipped to a rectangle. In fixed mode the visible step
+// range is computed up front from the same fixed-point positions the
+// rasterizer uses, so exactly the unclipped pixels inside the rectangle are
+// plotted and none outside are visited. Lines past the 32.32 range narrow
+// the step range in double and test the pixels left; float mode tests each
+// pixel.
+template <typename Sink>
+void ddaLineClipped(int x0, int y0, int x1, int y1, const ClipRect &clip, Sink &sink, DdaMode mode = DdaMode::Fixed)
+{
+    if (clip.xMin > clip.xMax || clip.yMin > clip.yMax)
+        return;
+
+    if (mode == DdaMode::Float)
+    {
+        ClippedSink<Sink> clipped{clip, sink};
+        ddaLineFloat(x0, y0, x1, y1, clipped);
+        return;
+    }
+
+    int64_t dx = static_cast<int64_t>(x1) - x0;
+    int64_t dy = static_cast<int64_t>(y1) - y0;
+    int64_t steps = std::max(std::abs(dx), std::abs(dy));
+
+    if (!ddaFitsFixed32(x0, y0, x1, y1))
+    {
+        int64_t first = 0;
+        int64_t last = steps;
+        if (steps > 0)
+        {
+            ddaDoubleClip(x0, static_cast<double>(dx) / steps, clip.xMin, clip.xMax, first, last);
+            ddaDoubleClip(y0, static_cast<double>(dy) / steps, clip.yMin, clip.yMax, first, last);
+        }
+        ClippedSink<Sink> clipped{clip, sink};
+        if (first <= last)
+            ddaLineFixed32(x0, y0, x1, y1, clipped, first, last);
+        return;
+    }
+
+    int shift = ddaFitsFixed16(x0, y0, x1, y1) ? 16 : 32;
+
+    int64_t first = 0;
+    int64_t last = steps;
+    ddaFixedClip(ddaFixedAxis(x0, dx, steps, shift), shift, clip.xMin, clip.xMax, first, last);
+    ddaFixedClip(ddaFixedAxis(y0, dy, steps, shift), shift, clip.yMin, clip.yMax, first, last);
+    if (first > last)
+        return;
+
+    if (shift == 16)
+        ddaLineFixed16(x0, y0, x1, y1, sink, first, last);
+    else
+        ddaLineFixed32(x0, y0, x1, y1, sink, first, last);
+}
+
+// Liang-Barsky: narrows [t0, t1] to the part of P1 + t * (P2 - P1) inside
+// the rectangle; returns false if nothing is left
+bool liangBarsky(float x1, float y1, float x2, float y2, float xMin, float yMin, float xMax, float yMax, float &t0, float &t1)
+{
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    const float p[4] = {-dx, dx, -dy, dy};
+    const float q[4] = {x1 - xMin, xMax - x1, y1 - yMin, yMax - y1};
+
+    for (int k = 0; k < 4; ++k)
+    {
+        if (p[k] == 0.0f)
+        {
+            if (q[k] < 0.0f)
+                return false;
+            continue;
+        }
+        float t = q[k] / p[k];
+        if (p[k] < 0.0f)
+            t0 = std::max(t0, t);
+        else
+            t1 = std::min(t1, t);
+    }
+    return t0 <= t1;
+}
+
+// generateLineVerticesSimd restricted to the samples inside the viewport
+// (default [-1, 1] on both axes). Liang-Barsky gives the visible parameter
+// range; the first and last sample are then settled by testing the actual
+// sample positions, so the result is exactly the visible unclipped samples.
+std::vector<float> generateLineVerticesClipped(float x1, float y1, float x2, float y2,
+                                               float xMin = -1.0f, float yMin = -1.0f, float xMax = 1.0f, float yMax = 1.0f)
+{
+    std::vector<float> vertices;
+
+    float t0 = 0.0f, t1 = 1.0f;
+    if (!liangBarsky(x1, y1, x2, y2, xMin, yMin, xMax, yMax, t0, t1))
+        return vertices;
+
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float steps = std::max(std::abs(dx), std::abs(dy));
+    int count = ddaSampleCount(x1, y1, x2, y2);
+    float xInc = steps > 0.0f ? dx / steps : 0.0f;
+    float yInc = steps > 0.0f ? dy / steps : 0.0f;
+
+    auto inside = [&](int i)
+    {
+        float x = static_cast<float>(i) * xInc + x1;
+        float y = static_cast<float>(i) * yInc + y1;
+        return x >= xMin && x <= xMax && y >= yMin && y <= yMax;
+    };
+
+    // Start one sample outside the estimate on each end, then tighten
+    int first = std::max(0, static_cast<int>(std::ceil(t0 * steps)) - 1);
+    int last = std::min(count - 1, static_cast<int>(std::floor(t1 * steps)) + 1);
+    while (first <= last && !inside(first))
+        ++first;
+    while (last >= first && !inside(last))
+        --last;
+
+    for (int i = first; i <= last; ++i)
+    {
+        vertices.push_back(static_cast<float>(i) * xInc + x1);
+        vertices.push_back(static_cast<float>(i) * yInc + y1);
+    }
     return vertices;
 }
 
-int main()
+// Pixel with anti-aliasing coverage in [0, 1]
+struct CoveragePixel
+{
+    int x;
+    int y;
+    float coverage;
+};
+
+// Coverage sinks take plot(int x, int y, float coverage)
+
+// Collects coverage triples
+struct CoverageVectorSink
+{
+    std::vector<CoveragePixel> &pixels;
+
+    void plot(int x, int y, float coverage)
+    {
+        pixels.push_back({x, y, coverage});
+    }
+};
+
+// Blends a white line into an 8-bit grayscale buffer, skipping pixels outside it
+struct GrayscaleBlendSink
+{
+    uint8_t *pixels;
+    int width;
+    int height;
+
+    void plot(int x, int y, float coverage)
+    {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t &dst = pixels[static_cast<size_t>(y) * width + x];
+        int alpha = static_cast<int>(coverage * 255.0f + 0.5f);
+        dst = static_cast<uint8_t>(dst + ((255 - dst) * alpha + 127) / 255);
+    }
+};
+
+inline float wuFract(float v)
+{
+    return v - std::floor(v);
+}
+
+// Endpoints of a Wu line in its stepping frame: the line runs along x from
+// xStart to xEnd with y = yStart + i * gradient for the inner columns,
+// and the two end columns are weighted by how much of them the line covers.
+struct WuSetup
+{
+    bool steep;
+    int xStart;
+    int xEnd;
+    float gradient;
+    float interY;
+};
+
+template <typename Sink>
+WuSetup wuSetupAndPlotEnds(float x0, float y0, float x1, float y1, Sink &sink)
+{
+    bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    if (steep)
+    {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1)
+    {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float gradient = dx == 0.0f ? 1.0f : dy / dx;
+
+    auto plot = [&](int x, int y, float coverage)
+    {
+        if (steep)
+            sink.plot(y, x, coverage);
+        else
+            sink.plot(x, y, coverage);
+    };
+
+    // First endpoint
+    float xEnd = std::floor(x0 + 0.5f);
+    float yEnd = y0 + gradient * (xEnd - x0);
+    float xGap = 1.0f - wuFract(x0 + 0.5f);
+    int xStartPixel = static_cast<int>(xEnd);
+    int yPixel = static_cast<int>(std::floor(yEnd));
+    plot(xStartPixel, yPixel, (1.0f - wuFract(yEnd)) * xGap);
+    plot(xStartPixel, yPixel + 1, wuFract(yEnd) * xGap);
+    float interY = yEnd + gradient;
+
+    // Second endpoint
+    xEnd = std::floor(x1 + 0.5f);
+    yEnd = y1 + gradient * (xEnd - x1);
+    xGap = wuFract(x1 + 0.5f);
+    int xEndPixel = static_cast<int>(xEnd);
+    yPixel = static_cast<int>(std::floor(yEnd));
+    plot(xEndPixel, yPixel, (1.0f - wuFract(yEnd)) * xGap);
+    plot(xEndPixel, yPixel + 1, wuFract(yEnd) * xGap);
+
+    return {steep, xStartPixel, xEndPixel, gradient, interY};
+}
+
+// Xiaolin Wu anti-aliased line between pixel-space endpoints. Each column
+// gets two vertically adjacent pixels (horizontal for steep lines) whose
+// coverages sum to 1.
+template <typename Sink>
+void wuLine(float x0, float y0, float x1, float y1, Sink &sink)
 {
+    WuSetup setup = wuSetupAndPlotEnds(x0, y0, x1, y1, sink);
+
+    int columns = setup.xEnd - setup.xStart - 1;
+    for (int i = 0; i < columns; ++i)
+    {
+        float y = static_cast<float>(i) * setup.gradient + setup.interY;
+        int x = setup.xStart + 1 + i;
+        int row = static_cast<int>(std::floor(y));
+        float f = y - std::floor(y);
+        if (setup.steep)
+        {
+            sink.plot(row, x, 1.0f - f);
+            sink.plot(row + 1, x, f);
+        }
+        else
+        {
+            sink.plot(x, row, 1.0f - f);
+            sink.plot(x, row + 1, f);
+        }
+    }
+}
+
+// For inner columns first..first + count of a Wu line: the row of each
+// column's pixel pair and the 8-bit coverage of its second pixel (row + 1);
+// the first pixel gets 255 - alpha.
+void wuCoverageScalar(float interY, float gradient, int first, int count, int *rows, uint8_t *alphas)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        float y = static_cast<float>(first + i) * gradient + interY;
+        float row = std::floor(y);
+        rows[i] = static_cast<int>(row);
+        alphas[i] = static_cast<uint8_t>(static_cast<int>((y - row) * 255.0f + 0.5f));
+    }
+}
+
+#if DDA_SIMD_X86
+// SSE2 has no floor, so truncate and step down where that rounded up
+void wuCoverageSse(float interY, float gradient, int first, int count, int *rows, uint8_t *alphas)
+{
+    const __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 vInterY = _mm_set1_ps(interY), vGradient = _mm_set1_ps(gradient);
+    const __m128 one = _mm_set1_ps(1.0f), scale = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 fi = _mm_add_ps(_mm_set1_ps(static_cast<float>(first + i)), lane);
+        __m128 y = _mm_add_ps(_mm_mul_ps(fi, vGradient), vInterY);
+        __m128 row = _mm_cvtepi32_ps(_mm_cvttps_epi32(y));
+        row = _mm_sub_ps(row, _mm_and_ps(_mm_cmpgt_ps(row, y), one));
+        __m128i alpha = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(y, row), scale), half));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(rows + i), _mm_cvttps_epi32(row));
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(alpha, alpha), _mm_setzero_si128());
+        int four = _mm_cvtsi128_si32(packed);
+        std::memcpy(alphas + i, &four, 4);
+    }
+    wuCoverageScalar(interY, gradient, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+#if DDA_SIMD_NEON && defined(__aarch64__)
+// vrndmq (floor) needs AArch64
+void wuCoverageNeon(float interY, float gradient, int first, int count, int *rows, uint8_t *alphas)
+{
+    const float laneInit[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+    const float32x4_t lane = vld1q_f32(laneInit);
+    const float32x4_t vInterY = vdupq_n_f32(interY), vGradient = vdupq_n_f32(gradient);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t fi = vaddq_f32(vdupq_n_f32(static_cast<float>(first + i)), lane);
+        float32x4_t y = vaddq_f32(vmulq_f32(fi, vGradient), vInterY);
+        float32x4_t row = vrndmq_f32(y);
+        int32x4_t alpha = vcvtq_s32_f32(vaddq_f32(vmulq_f32(vsubq_f32(y, row), vdupq_n_f32(255.0f)), vdupq_n_f32(0.5f)));
+
+        vst1q_s32(rows + i, vcvtq_s32_f32(row));
+        uint8x8_t narrow = vqmovun_s16(vcombine_s16(vqmovn_s32(alpha), vdup_n_s16(0)));
+        vst1_lane_u32(reinterpret_cast<uint32_t *>(alphas + i), vreinterpret_u32_u8(narrow), 0);
+    }
+    wuCoverageScalar(interY, gradient, first + i, count - i, rows + i, alphas + i);
+}
+#endif
+
+// Wu line blended straight into an 8-bit grayscale buffer. Rows and
+// coverages of the inner columns are computed several columns at a time,
+// then both pixels of each column are blended together.
+void wuLineBlend(float x0, float y0, float x1, float y1, uint8_t *gray, int width, int height)
+{
+#if DDA_SIMD_X86
+    auto coverage = wuCoverageSse;
+#elif DDA_SIMD_NEON && defined(__aarch64__)
+    auto coverage = wuCoverageNeon;
+#else
+    auto coverage = wuCoverageScalar;
+#endif
+
+    GrayscaleBlendSink sink{gray, width, height};
+    WuSetup setup = wuSetupAndPlotEnds(x0, y0, x1, y1, sink);
+
+    auto blend = [&](int x, int y, int alpha)
+    {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        uint8_t &dst = gray[static_cast<size_t>(y) * width + x];
+        dst = static_cast<uint8_t>(dst + ((255 - dst) * alpha + 127) / 255);
+    };
+
+    const int block = 64;
+    int rows[block];
+    uint8_t alphas[block];
+
+    int columns = setup.xEnd - setup.xStart - 1;
+    for (int first = 0; first < columns; first += block)
+    {
+        int count = std::min(block, columns - first);
+        coverage(setup.interY, setup.gradient, first, count, rows, alphas);
+        for (int i = 0; i < count; ++i)
+        {
+            int x = setup.xStart + 1 + first + i;
+            if (setup.steep)
+            {
+                blend(rows[i], x, 255 - alphas[i]);
+                blend(rows[i] + 1, x, alphas[i]);
+            }
+            else
+            {
+                blend(x, rows[i], 255 - alphas[i]);
+                blend(x, rows[i] + 1, alphas[i]);
+            }
+        }
+    }
+}
+
+// Checks ddaLineClipped against the unclipped rasterizer on the same steps
+// for lines up to the int range, including the +-2^30 pair just past the
+// 32.32 DDA, and that every line lands on both endpoints. Each line is
+// clipped to 17x17 rectangles centred on points along it; the reference
+// runs the steps near that point and drops pixels outside the rectangle.
+// Prints the result and returns whether every case matched.
+bool verifyClippedDda()
+{
+    struct ListSink
+    {
+        std::vector<Pixel> &pixels;
+
+        void plot(int x, int y)
+        {
+            pixels.push_back({x, y});
+        }
+    };
+
+    const int big = 1 << 30;
+    const int lines[][4] = {
+        {-big, 0, big, 0}, {-big, -big, big, big}, {big, -big, -big, big}, {-big + 1, 5, big - 1, -7},
+        {-big + 1, -big + 1, big - 1, big - 1}, {INT_MIN + 1, 3, INT_MAX, -3}, {INT_MIN + 1, INT_MIN + 1, INT_MAX, INT_MAX},
+        {-32767, -32767, 32767, 32767}, {-32767, 1, 32768, 0}, {0, 0, 1, big}, {5, 5, 5, 5}, {3, -2, 400, 123},
+    };
+
+    size_t cases = 0, mismatches = 0;
+    std::vector<Pixel> expected, actual;
+    auto same = [&]() {
+        if (expected.size() != actual.size())
+            return false;
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            if (expected[i].x != actual[i].x || expected[i].y != actual[i].y)
+                return false;
+        }
+        return true;
+    };
+
+    for (const auto &line : lines)
+    {
+        int x0 = line[0], y0 = line[1], x1 = line[2], y1 = line[3];
+        int64_t dx = static_cast<int64_t>(x1) - x0;
+        int64_t dy = static_cast<int64_t>(y1) - y0;
+        int64_t steps = std::max(std::abs(dx), std::abs(dy));
+        bool fixed16 = ddaFitsFixed16(x0, y0, x1, y1);
+
+        // Steps first..last of the rasterizer ddaLineClipped builds on
+        auto reference = [&](int64_t first, int64_t last, const ClipRect &clip) {
+            expected.clear();
+            ListSink list{expected};
+            ClippedSink<ListSink> clipped{clip, list};
+            if (fixed16)
+                ddaLineFixed16(x0, y0, x1, y1, clipped, first, last);
+            else
+                ddaLineFixed32(x0, y0, x1, y1, clipped, first, last);
+        };
+
+        const ClipRect everything = {INT_MIN, INT_MIN, INT_MAX, INT_MAX};
+        reference(0, 0, everything);
+        bool ok = expected.size() == 1 && expected[0].x == x0 && expected[0].y == y0;
+        reference(steps, steps, everything);
+        ok = ok && expected.size() == 1 && expected[0].x == x1 && expected[0].y == y1;
+        ++cases;
+        if (!ok)
+            ++mismatches;
+
+        for (int k = 0; k <= 16; ++k)
+        {
+            int64_t step = steps * k / 16;
+            double t = steps > 0 ? static_cast<double>(step) / steps : 0.0;
+            int64_t cx = std::llround(x0 + t * dx), cy = std::llround(y0 + t * dy);
+            ClipRect clip = {static_cast<int>(std::max<int64_t>(cx - 8, INT_MIN)), static_cast<int>(std::max<int64_t>(cy - 8, INT_MIN)),
+                             static_cast<int>(std::min<int64_t>(cx + 8, INT_MAX)), static_cast<int>(std::min<int64_t>(cy + 8, INT_MAX))};
+
+            reference(step - 32, step + 32, clip);
+            actual.clear();
+            ListSink list{actual};
+            ddaLineClipped(x0, y0, x1, y1, clip, list);
+            ++cases;
+            if (!same())
+                ++mismatches;
+        }
+    }
+    std::cout << "clipped dda: " << cases << " cases, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv)
+{
+    // Headless check of the clipped fixed-point DDA
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0)
+        return verifyClippedDda() ? 0 : 1;
+
     // Initialize GLFW
     if (!glfwInit())
     {
@@ -128,7 +1329,19 @@ int main()
 
     // Coordinates for l=the linee
     float x1 = -0.5f, y1 = -0.8f, x2 = 0.8f, y2 = 0.8f;
-    std::vector<float> lineVertices = generateLineVertices(x1, y1, x2, y2);
+
+    // Packed int16 pixel coordinates halve the vertex buffer and leave the
+    // pixel-to-NDC transform to the vertex shader
+    const bool usePackedVertices = true;
+
+    std::vector<float> lineVertices;
+    std::vector<int16_t> packedVertices;
+    if (usePackedVertices)
+        packedVertices = generateLinePackedVertices(static_cast<int>(x1 * 400), static_cast<int>(y1 * 400),
+                                                    static_cast<int>(x2 * 400), static_cast<int>(y2 * 400));
+    else
+        lineVertices = generateLineVertices(x1, y1, x2, y2);
+    GLsizei vertexCount = static_cast<GLsizei>(usePackedVertices ? packedVertices.size() / 2 : lineVertices.size() / 2);
 
     // Create VAO and VBO for Line
     GLuint VAO, VBO;
@@ -138,14 +1351,30 @@ int main()
     glBindVertexArray(VAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    if (usePackedVertices)
+    {
+        glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(int16_t), packedVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 2 * sizeof(int16_t), (void *)0);
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), lineVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    }
     glEnableVertexAttribArray(0);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // The 800x800 window spans 2 NDC units, so a pixel is 1/400; float
+    // vertices are already normalized
+    glUseProgram(shaderProgram);
+    if (usePackedVertices)
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f / 400.0f, 1.0f / 400.0f);
+    else
+        glUniform2f(glGetUniformLocation(shaderProgram, "uScale"), 1.0f, 1.0f);
+    glUniform2f(glGetUniformLocation(shaderProgram, "uOffset"), 0.0f, 0.0f);
+
     // Render Loop
     while (!glfwWindowShouldClose(window))
     {
@@ -155,7 +1384,7 @@ int main()
         // Use Shader Program and Draw Line
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO);
-        glDrawArrays(GL_LINE_STRIP, 0, lineVertices.size() / 2);
+        glDrawArrays(GL_LINE_STRIP, 0, vertexCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
@@ -2,6 +2,11 @@
 #include<glad/glad.h>
 #include<GLFW/glfw3.h>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
 
 #ifndef M_PI
     #define M_PI 3.14159265358979323846
@@ -23,8 +28,343 @@ const char* fragmentShaderSource = "#version 330 core\n"
 "   FragColor = vec4(1.0f, 0.0f, 0.0f, 1.0f);\n" //color
 "}\n\0";
 
-int main()
+// Fills a GL_TRIANGLE_STRIP ring between radiusInner and radiusOuter from
+// startAngle to endAngle: numSegments + 1 pairs of (outer, inner) x, y, z
+// vertices. Instead of calling cos and sin per segment, the unit direction is
+// rotated by the fixed segment angle each step,
+//   (c, s) -> (c * cos(step) - s * sin(step), s * cos(step) + c * sin(step)),
+// and both vertices are scaled from that one direction. Rounding makes the
+// length drift slowly, so it is pulled back to 1 every few steps.
+void generateRingVertices(GLfloat* vertices, int numSegments, float radiusInner, float radiusOuter, float startAngle, float endAngle)
 {
+    const int renormalizeInterval = 64;
+
+    double step = (static_cast<double>(endAngle) - startAngle) / numSegments;
+    double stepCos = cos(step);
+    double stepSin = sin(step);
+    double c = cos(static_cast<double>(startAngle));
+    double s = sin(static_cast<double>(startAngle));
+
+    for (int i = 0; i <= numSegments; ++i) {
+        // Outer circle vertex
+        vertices[6 * i] = static_cast<GLfloat>(radiusOuter * c);
+        vertices[6 * i + 1] = static_cast<GLfloat>(radiusOuter * s);
+        vertices[6 * i + 2] = 0.0f;
+
+        // Inner circle vertex
+        vertices[6 * i + 3] = static_cast<GLfloat>(radiusInner * c);
+        vertices[6 * i + 4] = static_cast<GLfloat>(radiusInner * s);
+        vertices[6 * i + 5] = 0.0f;
+
+        double nextC = c * stepCos - s * stepSin;
+        s = s * stepCos + c * stepSin;
+        c = nextC;
+        if ((i + 1) % renormalizeInterval == 0) {
+            double scale = 1.0 / sqrt(c * c + s * s);
+            c *= scale;
+            s *= scale;
+        }
+    }
+}
+
+// Copies x, y, z vertices rotated by 180 degrees (x and y negated), giving
+// the symmetric half of the logo ring without recomputing it
+void flipVertices(const GLfloat* source, GLfloat* destination, int vertexCount)
+{
+    for (int i = 0; i < vertexCount; ++i) {
+        destination[3 * i] = -source[3 * i];
+        destination[3 * i + 1] = -source[3 * i + 1];
+        destination[3 * i + 2] = source[3 * i + 2];
+    }
+}
+
+// Number of segments for an arc of the given radius (in pixels) and sweep
+// (in radians) such that no chord strays more than maxError pixels from the
+// arc. A chord spanning angle a sits radius * (1 - cos(a / 2)) inside the
+// arc, so small arcs get a handful of segments and large ones stay smooth.
+int arcSegmentCount(float radiusPixels, float sweep, float maxError = 0.25f)
+{
+    double cosHalfStep = radiusPixels > 0.0f ? max(-1.0, 1.0 - static_cast<double>(maxError) / radiusPixels) : -1.0;
+    double step = 2.0 * acos(cosHalfStep);
+    return max(1, static_cast<int>(ceil(fabs(sweep) / step)));
+}
+
+// Segment count for an ellipse arc traced by its angle parameter. The chord
+// error of a parameter step is largest at the ends of the major axis, where
+// it matches that of a circle with the major radius.
+int ellipseSegmentCount(float rxPixels, float ryPixels, float sweep, float maxError = 0.25f)
+{
+    return arcSegmentCount(max(rxPixels, ryPixels), sweep, maxError);
+}
+
+// Fills numSegments + 1 x, y, z vertices of an axis-aligned ellipse arc
+// around (centerX, centerY) for GL_LINE_STRIP, with the angle parameter
+// advanced by the same rotation recurrence as generateRingVertices
+void generateEllipseArcVertices(GLfloat* vertices, int numSegments, float centerX, float centerY, float rx, float ry, float startAngle, float endAngle)
+{
+    const int renormalizeInterval = 64;
+
+    double step = (static_cast<double>(endAngle) - startAngle) / numSegments;
+    double stepCos = cos(step);
+    double stepSin = sin(step);
+    double c = cos(static_cast<double>(startAngle));
+    double s = sin(static_cast<double>(startAngle));
+
+    for (int i = 0; i <= numSegments; ++i) {
+        vertices[3 * i] = static_cast<GLfloat>(centerX + rx * c);
+        vertices[3 * i + 1] = static_cast<GLfloat>(centerY + ry * s);
+        vertices[3 * i + 2] = 0.0f;
+
+        double nextC = c * stepCos - s * stepSin;
+        s = s * stepCos + c * stepSin;
+        c = nextC;
+        if ((i + 1) % renormalizeInterval == 0) {
+            double scale = 1.0 / sqrt(c * c + s * s);
+            c *= scale;
+            s *= scale;
+        }
+    }
+}
+
+// Horizontal run of pixels on row y, inclusive on both ends
+struct HorizontalSpan
+{
+    int y;
+    int xStart;
+    int xEnd;
+};
+
+// Leftmost and rightmost outline pixel of a midpoint circle in each row of
+// the upper-right quadrant, indexed by row 0..radius
+void midpointCircleRows(int radius, vector<int>& minX, vector<int>& maxX)
+{
+    minX.assign(radius + 1, radius + 1);
+    maxX.assign(radius + 1, -1);
+    auto plot = [&](int x, int y) {
+        minX[y] = min(minX[y], x);
+        maxX[y] = max(maxX[y], x);
+    };
+
+    int x = 0;
+    int y = radius;
+    int p = 1 - radius;
+    while (x <= y) {
+        plot(x, y);
+        plot(y, x);
+        ++x;
+        if (p < 0) {
+            p += 2 * x + 1;
+        } else {
+            --y;
+            p += 2 * (x - y) + 1;
+        }
+    }
+}
+
+// x range [lo, hi] of row y inside the wedge from angle a counterclockwise
+// to angle b, for b - a <= pi: the intersection of the half-planes left of
+// direction a and right of direction b, cut to the side of the bisector so
+// a zero-width wedge stays a ray rather than a line. Empty when lo > hi.
+// An open wedge leaves out its two edges. Where an edge is horizontal the
+// row is either wholly inside its half-plane or lies on the edge itself,
+// so the open case drops that row here; a sloped edge only touches the row
+// at lo or hi and the caller excludes those ends.
+void wedgeRowRange(int y, double a, double b, double& lo, double& hi, bool open = false)
+{
+    lo = -HUGE_VAL;
+    hi = HUGE_VAL;
+    double ca = cos(a), sa = sin(a), cb = cos(b), sb = sin(b);
+    const double eps = 1e-12;
+
+    // ca * y - sa * x >= 0
+    if (sa > eps)
+        hi = min(hi, ca * y / sa);
+    else if (sa < -eps)
+        lo = max(lo, ca * y / sa);
+    else if (open ? ca * y <= 0.0 : ca * y < 0.0)
+        hi = -HUGE_VAL;
+
+    // sb * x - cb * y >= 0
+    if (sb > eps)
+        lo = max(lo, cb * y / sb);
+    else if (sb < -eps)
+        hi = min(hi, cb * y / sb);
+    else if (open ? cb * y >= 0.0 : cb * y > 0.0)
+        hi = -HUGE_VAL;
+
+    // cm * x + sm * y >= 0
+    double cm = cos(0.5 * (a + b)), sm = sin(0.5 * (a + b));
+    if (cm > eps)
+        lo = max(lo, -sm * y / cm);
+    else if (cm < -eps)
+        hi = min(hi, -sm * y / cm);
+    else if (sm * y < 0.0)
+        hi = -HUGE_VAL;
+}
+
+// Annulus between two midpoint circles around (centerX, centerY), appended
+// as horizontal spans. Both circles are walked row by row in lockstep: each
+// row covers the pixels from the outer outline in to the inner outline,
+// both outlines included, so the ring is filled exactly once with no
+// triangulation. Only pixels whose angle lies in the sector from startAngle
+// counterclockwise to endAngle are kept; the default is the whole ring.
+void annulusSpans(int centerX, int centerY, int innerRadius, int outerRadius, vector<HorizontalSpan>& spans,
+                  double startAngle = 0.0, double endAngle = 2.0 * M_PI)
+{
+    vector<int> outerMin, outerMax, innerMin, innerMax;
+    midpointCircleRows(outerRadius, outerMin, outerMax);
+    midpointCircleRows(innerRadius, innerMin, innerMax);
+
+    double sweep = endAngle - startAngle;
+    if (sweep < 0.0)
+        return;
+    bool wholeRing = sweep >= 2.0 * M_PI;
+    const double tolerance = 1e-9;
+
+    // Clips [xStart, xEnd] on row dy (relative to the center) to the sector.
+    // A sector over pi is the ring minus the open wedge it leaves out.
+    auto emit = [&](int dy, int xStart, int xEnd) {
+        if (wholeRing) {
+            spans.push_back({ centerY + dy, centerX + xStart, centerX + xEnd });
+            return;
+        }
+
+        double lo, hi;
+        if (sweep <= M_PI) {
+            wedgeRowRange(dy, startAngle, endAngle, lo, hi);
+            int first = max(xStart, static_cast<int>(max(ceil(lo - tolerance), -1e9)));
+            int last = min(xEnd, static_cast<int>(min(floor(hi + tolerance), 1e9)));
+            if (first <= last)
+                spans.push_back({ centerY + dy, centerX + first, centerX + last });
+            return;
+        }
+
+        wedgeRowRange(dy, endAngle, startAngle + 2.0 * M_PI, lo, hi, true);
+        int cutFirst = static_cast<int>(max(floor(lo + tolerance) + 1.0, -1e9));
+        int cutLast = static_cast<int>(min(ceil(hi - tolerance) - 1.0, 1e9));
+        if (lo > hi || cutFirst > cutLast || cutLast < xStart || cutFirst > xEnd) {
+            spans.push_back({ centerY + dy, centerX + xStart, centerX + xEnd });
+            return;
+        }
+        if (xStart < cutFirst)
+            spans.push_back({ centerY + dy, centerX + xStart, centerX + cutFirst - 1 });
+        if (cutLast < xEnd)
+            spans.push_back({ centerY + dy, centerX + cutLast + 1, centerX + xEnd });
+    };
+
+    for (int row = outerRadius; row >= -outerRadius; --row) {
+        int dy = row < 0 ? -row : row;
+        int outer = outerMax[dy];
+        if (dy > innerRadius || innerMin[dy] == 0) {
+            emit(row, -outer, outer);
+        } else {
+            emit(row, -outer, -innerMin[dy]);
+            emit(row, innerMin[dy], outer);
+        }
+    }
+}
+
+// Headless export: fills the logo ring on the CPU into an 8-bit grayscale
+// image and writes it as a binary PGM, for machines without a GPU
+bool exportRing(const char* path, int size, float radiusInner, float radiusOuter, float startAngle, float endAngle)
+{
+    float pixelsPerUnit = size / 2.0f;
+    vector<HorizontalSpan> spans;
+    annulusSpans(0, 0, static_cast<int>(radiusInner * pixelsPerUnit), static_cast<int>(radiusOuter * pixelsPerUnit),
+                 spans, startAngle, endAngle);
+    annulusSpans(0, 0, static_cast<int>(radiusInner * pixelsPerUnit), static_cast<int>(radiusOuter * pixelsPerUnit),
+                 spans, startAngle + M_PI, endAngle + M_PI); // The flipped half-ring
+
+    // Image rows run downwards from the top of the NDC square
+    vector<uint8_t> image(static_cast<size_t>(size) * size, 0);
+    int half = size / 2;
+    for (const HorizontalSpan& span : spans) {
+        int row = half - 1 - span.y;
+        int first = max(span.xStart + half, 0);
+        int last = min(span.xEnd + half, size - 1);
+        if (row >= 0 && row < size && first <= last)
+            memset(image.data() + static_cast<size_t>(row) * size + first, 255, last - first + 1);
+    }
+
+    ofstream file(path, ios::binary);
+    file << "P5\n" << size << " " << size << "\n255\n";
+    file.write(reinterpret_cast<const char*>(image.data()), image.size());
+    return static_cast<bool>(file);
+}
+
+// Brute-force check of annulusSpans: for every start angle and sweep that is
+// a multiple of pi/4, which puts sector edges on rows, columns and
+// diagonals, each pixel of the ring must be covered exactly once when its
+// angle lies in the closed sector, boundary rays included, and never
+// otherwise. Prints the result and returns whether every case matched.
+bool verifySectors()
+{
+    const int radii[][2] = { { 0, 1 }, { 1, 2 }, { 0, 5 }, { 3, 17 }, { 20, 40 }, { 32, 107 }, { 107, 107 } };
+    size_t cases = 0, mismatches = 0;
+    for (const auto& radius : radii) {
+        int inner = radius[0], outer = radius[1], size = 2 * outer + 1;
+        vector<int> outerMin, outerMax, innerMin, innerMax;
+        midpointCircleRows(outer, outerMin, outerMax);
+        midpointCircleRows(inner, innerMin, innerMax);
+
+        for (int s = -8; s <= 8; ++s) {
+            for (int w = 0; w <= 8; ++w) {
+                double start = s * M_PI / 4, sweep = w * M_PI / 4;
+                vector<HorizontalSpan> spans;
+                annulusSpans(0, 0, inner, outer, spans, start, start + sweep);
+                vector<int> hits(static_cast<size_t>(size) * size, 0);
+                for (const HorizontalSpan& span : spans) {
+                    for (int x = span.xStart; x <= span.xEnd; ++x)
+                        ++hits[static_cast<size_t>(span.y + outer) * size + x + outer];
+                }
+
+                ++cases;
+                bool ok = true;
+                for (int y = -outer; y <= outer; ++y) {
+                    for (int x = -outer; x <= outer; ++x) {
+                        int dy = abs(y);
+                        bool ring = abs(x) <= outerMax[dy] && !(dy <= inner && abs(x) < innerMin[dy]);
+                        double offset = fmod(atan2(y, x) - start, 2.0 * M_PI);
+                        if (offset < 0.0)
+                            offset += 2.0 * M_PI;
+                        bool inSector = (x == 0 && y == 0) || offset <= sweep + 1e-9 || offset >= 2.0 * M_PI - 1e-9;
+                        if (hits[static_cast<size_t>(y + outer) * size + x + outer] != (ring && inSector ? 1 : 0))
+                            ok = false;
+                    }
+                }
+                if (!ok)
+                    ++mismatches;
+            }
+        }
+    }
+    std::cout << "sectors: " << cases << " cases, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+int main(int argc, char** argv)
+{
+    // Circle details for the ring
+    const float radiusOuter = 0.95f;
+    const float radiusInner = 0.75f;
+    const float startAngle = M_PI / 4;  // Start at 45 degrees
+    const float endAngle = M_PI; // End at 135 degrees
+
+    // Headless export of the ring, filled on the CPU without a window
+    if (argc > 1 && strcmp(argv[1], "--export") == 0)
+    {
+        const char* path = argc > 2 ? argv[2] : "logo_ring.pgm";
+        if (!exportRing(path, 800, radiusInner, radiusOuter, startAngle, endAngle))
+        {
+            std::cout << "Failed to write " << path << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    // Headless coverage check of the sector filler
+    if (argc > 1 && strcmp(argv[1], "--verify") == 0)
+        return verifySectors() ? 0 : 1;
+
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
@@ -102,40 +442,14 @@ int main()
     glBindVertexArray(0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
-	// Circle details for the ring
-	const int numSegments = 100;  // Total segments for the ring
-	const float radiusOuter = 0.95f;
-	const float radiusInner = 0.75f;
-	const float startAngle = M_PI / 4;  // Start at 45 degrees
-	const float endAngle = M_PI; // End at 135 degrees
-
-	// Calculate the number of segments required for the arc between start 	and end angles
-	GLfloat circleVertices[6 * (numSegments + 1)];
-
-	int vertexIndex = 0;
-	for (int i = 0; i <= numSegments; ++i) {
-	    float angle = startAngle + (endAngle - startAngle) * i / numSegments;
-	
-	    // Calculate outer ring position
-	    float outerX = radiusOuter * cos(angle);
-	    float outerY = radiusOuter * sin(angle);
-	
-	    // Calculate inner ring position
-	    float innerX = radiusInner * cos(angle);
-	    float innerY = radiusInner * sin(angle);
+	// Segments for the arc between start and end angles, from the outer
+	// radius on screen: the 800 px viewport spans 2 NDC units
+	const float pixelsPerUnit = 400.0f;
+	const float maxChordError = 0.25f; // In pixels
+	const int numSegments = arcSegmentCount(radiusOuter * pixelsPerUnit, endAngle - startAngle, maxChordError);
+	vector<GLfloat> circleVertices(6 * (numSegments + 1));
 
-	    // Outer circle vertex
-	    circleVertices[6 * vertexIndex] = outerX;
-	    circleVertices[6 * vertexIndex + 1] = outerY;
-	    circleVertices[6 * vertexIndex + 2] = 0.0f;
-
-	    // Inner circle vertex
-	    circleVertices[6 * vertexIndex + 3] = innerX;
-	    circleVertices[6 * vertexIndex + 4] = innerY;
-	    circleVertices[6 * vertexIndex + 5] = 0.0f;
-
-	    vertexIndex++;
-	}
+	generateRingVertices(circleVertices.data(), numSegments, radiusInner, radiusOuter, startAngle, endAngle);
 
 
 
@@ -145,44 +459,15 @@ glGenBuffers(1, &circleVBO);
 
 glBindVertexArray(circleVAO);
 glBindBuffer(GL_ARRAY_BUFFER, circleVBO);
-glBufferData(GL_ARRAY_BUFFER, sizeof(circleVertices), circleVertices, GL_STATIC_DRAW);
+glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(GLfloat), circleVertices.data(), GL_STATIC_DRAW);
 glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 glEnableVertexAttribArray(0);
 glBindVertexArray(0);
 
 
-GLfloat flippedCircleVertices[6 * (numSegments + 1)];
-vertexIndex = 0;
-for (int i = 0; i <= numSegments; ++i) {
-    float angle = startAngle + (endAngle - startAngle) * i / numSegments;
-
-    // Calculate outer ring position
-    float outerX = radiusOuter * cos(angle);
-    float outerY = radiusOuter * sin(angle);
-
-    // Calculate inner ring position
-    float innerX = radiusInner * cos(angle);
-    float innerY = radiusInner * sin(angle);
-
-    // Flip both X and Y coordinates for the second half-ring
-    outerX = -outerX; // Flip horizontally
-    outerY = -outerY; // Flip vertically
-    innerX = -innerX; // Flip horizontally
-    innerY = -innerY; // Flip vertically
-
-
-    // Outer circle vertex (flipped)
-    flippedCircleVertices[6 * vertexIndex] = outerX;
-    flippedCircleVertices[6 * vertexIndex + 1] = outerY;
-    flippedCircleVertices[6 * vertexIndex + 2] = 0.0f;
-
-    // Inner circle vertex (flipped)
-    flippedCircleVertices[6 * vertexIndex + 3] = innerX;
-    flippedCircleVertices[6 * vertexIndex + 4] = innerY;
-    flippedCircleVertices[6 * vertexIndex + 5] = 0.0f;
-
-    vertexIndex++;
-}
+// The second half-ring is the first one rotated by 180 degrees
+vector<GLfloat> flippedCircleVertices(circleVertices.size());
+flipVertices(circleVertices.data(), flippedCircleVertices.data(), 2 * (numSegments + 1));
 
 GLuint flippedCircleVAO, flippedCircleVBO;
 glGenVertexArrays(1, &flippedCircleVAO);
@@ -190,7 +475,7 @@ glGenBuffers(1, &flippedCircleVBO);
 
 glBindVertexArray(flippedCircleVAO);
 glBindBuffer(GL_ARRAY_BUFFER, flippedCircleVBO);
-glBufferData(GL_ARRAY_BUFFER, sizeof(flippedCircleVertices), flippedCircleVertices, GL_STATIC_DRAW);
+glBufferData(GL_ARRAY_BUFFER, flippedCircleVertices.size() * sizeof(GLfloat), flippedCircleVertices.data(), GL_STATIC_DRAW);
 glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 glEnableVertexAttribArray(0);
 glBindVertexArray(0);